@@ -0,0 +1,114 @@
+#include "Allocations.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+        /// The total amount of allocations made by the process.
+    std::atomic<std::uint64_t> allocation_count(0);
+
+        /// The total amount of bytes allocated by the process.
+    std::atomic<std::uint64_t> allocated_byte_count(0);
+
+} // namespace
+
+namespace expert_system::bench {
+
+    std::uint64_t AllocationCount() {
+        return allocation_count.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t AllocatedBytes() {
+        return allocated_byte_count.load(std::memory_order_relaxed);
+    }
+
+} // namespace expert_system::bench
+
+/// Counting replacement of the global allocation function.
+void* operator new(std::size_t size) {
+    // Count the allocation
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    allocated_byte_count.fetch_add(size, std::memory_order_relaxed);
+
+    // Allocate the memory, at least one byte is required for a unique address
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+/// Counting replacement of the global array allocation function.
+void* operator new[](std::size_t size) {
+    // Allocate through the single-object function
+    return operator new(size);
+}
+
+/// Counting replacement of the global over-aligned allocation function.
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    // Count the allocation
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    allocated_byte_count.fetch_add(size, std::memory_order_relaxed);
+
+    // Allocate the memory, aligned_alloc requires a size that is a multiple of the alignment
+    auto align = static_cast<std::size_t>(alignment);
+    auto aligned_size = ((size == 0 ? 1 : size) + align - 1) / align * align;
+    if (void* memory = std::aligned_alloc(align, aligned_size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+/// Counting replacement of the global over-aligned array allocation function.
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    // Allocate through the single-object function
+    return operator new(size, alignment);
+}
+
+/// Replacement of the global deallocation function, which frees the memory of every allocation function above.
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+/// Replacement of the global array deallocation function.
+void operator delete[](void* memory) noexcept {
+    // Free through the single-object function
+    operator delete(memory);
+}
+
+/// Replacement of the global sized deallocation function.
+void operator delete(void* memory, std::size_t) noexcept {
+    // Free through the single-object function
+    operator delete(memory);
+}
+
+/// Replacement of the global sized array deallocation function.
+void operator delete[](void* memory, std::size_t) noexcept {
+    // Free through the single-object function
+    operator delete(memory);
+}
+
+/// Replacement of the global over-aligned deallocation function.
+void operator delete(void* memory, std::align_val_t) noexcept {
+    // Free through the single-object function, as aligned_alloc memory is released by free
+    operator delete(memory);
+}
+
+/// Replacement of the global over-aligned array deallocation function.
+void operator delete[](void* memory, std::align_val_t) noexcept {
+    // Free through the single-object function
+    operator delete(memory);
+}
+
+/// Replacement of the global sized over-aligned deallocation function.
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept {
+    // Free through the single-object function
+    operator delete(memory);
+}
+
+/// Replacement of the global sized over-aligned array deallocation function.
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept {
+    // Free through the single-object function
+    operator delete(memory);
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+namespace expert_system::bench {
+
+        /**
+         * @brief Gathers the total amount of allocations made by the process.
+         * Counted by the replacements of the global allocation functions, which are kept in their own source file
+         * so that the compiler cannot pair their bodies with allocations made elsewhere.
+         * @return The amount of allocations.
+         */
+    std::uint64_t AllocationCount();
+
+        /**
+         * @brief Gathers the total amount of bytes allocated by the process.
+         * @return The amount of bytes.
+         */
+    std::uint64_t AllocatedBytes();
+
+} // namespace expert_system::bench
@@ -0,0 +1,566 @@
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "bench/Generator.hpp"
+#include "bench/Harness.hpp"
+#include "engines/inference/Agenda.hpp"
+#include "engines/inference/Bytecode.hpp"
+#include "engines/inference/Forward.hpp"
+#include "engines/inference/MatchNetwork.hpp"
+#include "knowledge/BinaryFormat.hpp"
+#include "knowledge/StreamLoader.hpp"
+#include "knowledge/rules/Conditions.hpp"
+#include "utility/DynamicEnum.hpp"
+#include "utility/SymbolsJSON.hpp"
+#include "utility/ThreadPool.hpp"
+
+namespace expert_system::bench {
+
+    namespace {
+
+            /**
+             * @brief Generates a knowledge base with every Fact known, for benchmarking Condition tests.
+             * @param [in] settings The shape of the knowledge base.
+             * @return The generated knowledge base, with its initial session values already assigned.
+             */
+        KnowledgeBase KnownKnowledgeBase(GeneratorSettings settings) {
+            settings.initial_fraction_ = 1.0;
+            auto knowledge_base = Generate(settings);
+            knowledge_base.facts_.ImportValues(knowledge_base.initial_values_);
+            return knowledge_base;
+        }
+
+            /**
+             * @brief Benchmarks testing a single Condition of a specific type.
+             * @param [in] state The benchmark's running state.
+             * @param [in] type The type of the Condition to test.
+             */
+        void ConditionTest(State& state, utility::ExpertSystemTypes type) {
+            // Generate one Rule reading a single known Fact of the requested type
+            GeneratorSettings settings;
+            settings.fact_count_ = 2;
+            settings.rule_count_ = 1;
+            settings.chain_length_ = 1;
+            settings.type_weights_ = {0, 0, 0, 0};
+            settings.type_weights_[(std::size_t) type - (std::size_t) utility::ExpertSystemTypes::kBool] = 1;
+            auto knowledge_base = KnownKnowledgeBase(settings);
+            auto& condition = knowledge_base.rules_.managed_rules_.begin()->second.trigger_.root_condition_;
+
+            for (auto _: state) {
+                DoNotOptimize(condition.Test(knowledge_base.facts_));
+            }
+        }
+
+            /**
+             * @brief Benchmarks a full forward chaining consultation, until no more Rules can be triggered.
+             * @param [in] state The benchmark's running state.
+             * @param [in] settings The shape of the knowledge base.
+             * @param [in] use_network True to use a MatchNetwork, False to scan every Rule each round.
+             * @param [in] strategy The ConflictStrategy to run the Rules one at a time with, requires use_network.
+             */
+        void Consultation(State& state, const GeneratorSettings& settings, bool use_network,
+                          std::optional<engines::inference::ConflictStrategy> strategy = std::nullopt) {
+            auto knowledge_base = Generate(settings);
+            engines::inference::MatchNetwork network(knowledge_base.rules_);
+            engines::inference::Agenda agenda(strategy.value_or(engines::inference::ConflictStrategy::kSalience));
+            std::size_t fired_rules = 0;
+
+            for (auto _: state) {
+                // Restore the initial session state outside of the timer
+                state.PauseTiming();
+                knowledge_base.facts_.Reset();
+                knowledge_base.rules_.ResetRules();
+                knowledge_base.facts_.ImportValues(knowledge_base.initial_values_);
+                state.ResumeTiming();
+
+                if (use_network) {
+                    // Run the consultation through the match network, and the Agenda if requested
+                    auto trace = strategy.has_value()
+                            ? engines::inference::forward::RunToCompletion(
+                                    knowledge_base.facts_, knowledge_base.rules_, network, agenda)
+                            : engines::inference::forward::RunToCompletion(
+                                    knowledge_base.facts_, knowledge_base.rules_, network);
+                    fired_rules = trace.EventCount();
+                } else {
+                    // Run the consultation by scanning every Rule each round, stopping as RunToCompletion() does
+                    fired_rules = 0;
+                    while (knowledge_base.facts_.AnyUnknown()) {
+                        auto trigger_list = engines::inference::forward::FindTriggered(
+                                knowledge_base.facts_, knowledge_base.rules_);
+                        if (trigger_list.empty()) {
+                            break;
+                        }
+                        fired_rules += engines::inference::forward::RunTriggered(
+                                trigger_list, knowledge_base.facts_).size();
+                    }
+                }
+            }
+            state.SetLabel(Describe(settings) + " fired=" + std::to_string(fired_rules));
+        }
+
+            /**
+             * @brief Creates the settings for a consultation benchmark.
+             * @param [in] fact_count The amount of Facts.
+             * @param [in] rule_count The amount of Rules.
+             * @return The settings.
+             */
+        GeneratorSettings ConsultationSettings(std::size_t fact_count, std::size_t rule_count) {
+            GeneratorSettings settings;
+            settings.fact_count_ = fact_count;
+            settings.rule_count_ = rule_count;
+            return settings;
+        }
+
+            /**
+             * @brief Benchmarks branching a FactDatabase and changing one session value in the branch.
+             * @param [in] state The benchmark's running state.
+             * @param [in] fork True to branch with FactDatabase::Fork(), False to take a full copy.
+             */
+        void FactDatabaseBranch(State& state, bool fork) {
+            // Generate the Facts with half of them known
+            GeneratorSettings settings;
+            settings.fact_count_ = 10000;
+            settings.rule_count_ = 0;
+            settings.initial_fraction_ = 0.5;
+            auto knowledge_base = Generate(settings);
+            knowledge_base.facts_.ImportValues(knowledge_base.initial_values_);
+
+            // Pick a single session value to change in each branch
+            nlohmann::json one_change = nlohmann::json::object();
+            if (!knowledge_base.initial_values_.empty()) {
+                auto first_entry = knowledge_base.initial_values_.begin();
+                one_change[first_entry.key()] = first_entry.value();
+            }
+
+            for (auto _: state) {
+                // Branch the Facts, then change one session value
+                auto branch = fork ? knowledge_base.facts_.Fork() : knowledge_base.facts_;
+                DoNotOptimize(branch.ImportValues(one_change));
+            }
+            state.SetLabel(Describe(settings));
+        }
+    } // namespace
+
+    void BM_ConditionTest_Bool(State& state) {
+        ConditionTest(state, utility::ExpertSystemTypes::kBool);
+    }
+    ESS_BENCHMARK(BM_ConditionTest_Bool);
+
+    void BM_ConditionTest_Int(State& state) {
+        ConditionTest(state, utility::ExpertSystemTypes::kInt);
+    }
+    ESS_BENCHMARK(BM_ConditionTest_Int);
+
+    void BM_ConditionTest_Float(State& state) {
+        ConditionTest(state, utility::ExpertSystemTypes::kFloat);
+    }
+    ESS_BENCHMARK(BM_ConditionTest_Float);
+
+    void BM_ConditionTest_Enum(State& state) {
+        ConditionTest(state, utility::ExpertSystemTypes::kEnum);
+    }
+    ESS_BENCHMARK(BM_ConditionTest_Enum);
+
+    void BM_AntecedentTest(State& state) {
+        // Generate one Rule with a long chain of Conditions, reading known Facts
+        GeneratorSettings settings;
+        settings.fact_count_ = 16;
+        settings.rule_count_ = 1;
+        settings.chain_length_ = 8;
+        auto knowledge_base = KnownKnowledgeBase(settings);
+        auto& antecedent = knowledge_base.rules_.managed_rules_.begin()->second.trigger_;
+
+        for (auto _: state) {
+            DoNotOptimize(antecedent.Test(knowledge_base.facts_));
+        }
+        state.SetLabel(Describe(settings));
+    }
+    ESS_BENCHMARK(BM_AntecedentTest);
+
+    void BM_AntecedentBytecode(State& state) {
+        // Generate the same Rule as BM_AntecedentTest, and compile each of its Conditions as a MatchNetwork would
+        GeneratorSettings settings;
+        settings.fact_count_ = 16;
+        settings.rule_count_ = 1;
+        settings.chain_length_ = 8;
+        auto knowledge_base = KnownKnowledgeBase(settings);
+        auto& antecedent = knowledge_base.rules_.managed_rules_.begin()->second.trigger_;
+        engines::inference::BytecodeProgram program;
+        std::vector<std::size_t> entries{program.Compile(antecedent.root_condition_)};
+        for (auto& current_pair: antecedent.condition_chain_) {
+            entries.push_back(program.Compile(current_pair.second));
+        }
+
+        // Test every alpha node, as MatchNetwork::Synchronize() does
+        for (auto _: state) {
+            for (auto current_entry: entries) {
+                DoNotOptimize(program.Run(current_entry, knowledge_base.facts_));
+            }
+        }
+        state.SetLabel(Describe(settings));
+    }
+    ESS_BENCHMARK(BM_AntecedentBytecode);
+
+    void BM_FactDatabaseFind(State& state) {
+        // Generate the Facts and their names up front
+        GeneratorSettings settings;
+        settings.fact_count_ = 1000;
+        settings.rule_count_ = 0;
+        auto knowledge_base = Generate(settings);
+        std::vector<std::string> fact_names;
+        for (std::size_t fact_index = 0; fact_index < settings.fact_count_; ++fact_index) {
+            fact_names.push_back("F" + std::to_string(fact_index));
+        }
+
+        // Cycle through the names
+        std::size_t next_name = 0;
+        for (auto _: state) {
+            DoNotOptimize(knowledge_base.facts_.Find(fact_names[next_name]));
+            next_name = (next_name + 1) % fact_names.size();
+        }
+        state.SetLabel(Describe(settings));
+    }
+    ESS_BENCHMARK(BM_FactDatabaseFind);
+
+    void BM_FactDatabaseListKnown(State& state) {
+        // Generate the Facts with half of them known
+        GeneratorSettings settings;
+        settings.fact_count_ = 1000;
+        settings.rule_count_ = 0;
+        settings.initial_fraction_ = 0.5;
+        auto knowledge_base = Generate(settings);
+        knowledge_base.facts_.ImportValues(knowledge_base.initial_values_);
+
+        for (auto _: state) {
+            DoNotOptimize(knowledge_base.facts_.List(knowledge::facts::FactFilter::kHasValue));
+        }
+        state.SetLabel(Describe(settings));
+    }
+    ESS_BENCHMARK(BM_FactDatabaseListKnown);
+
+    void BM_FactDatabaseCopy(State& state) {
+        FactDatabaseBranch(state, false);
+    }
+    ESS_BENCHMARK(BM_FactDatabaseCopy);
+
+    void BM_FactDatabaseFork(State& state) {
+        FactDatabaseBranch(state, true);
+    }
+    ESS_BENCHMARK(BM_FactDatabaseFork);
+
+    void BM_FindTriggered(State& state) {
+        // Generate a knowledge base with its initial session values
+        auto settings = ConsultationSettings(1000, 1000);
+        auto knowledge_base = Generate(settings);
+        knowledge_base.facts_.ImportValues(knowledge_base.initial_values_);
+
+        for (auto _: state) {
+            DoNotOptimize(engines::inference::forward::FindTriggered(knowledge_base.facts_, knowledge_base.rules_));
+        }
+        state.SetLabel(Describe(settings));
+    }
+    ESS_BENCHMARK(BM_FindTriggered);
+
+    void BM_FindTriggered_Ids(State& state) {
+        // Generate the same knowledge base as BM_FindTriggered
+        auto settings = ConsultationSettings(1000, 1000);
+        auto knowledge_base = Generate(settings);
+        knowledge_base.facts_.ImportValues(knowledge_base.initial_values_);
+
+        for (auto _: state) {
+            DoNotOptimize(engines::inference::forward::FindTriggeredIds(knowledge_base.facts_, knowledge_base.rules_));
+        }
+        state.SetLabel(Describe(settings));
+    }
+    ESS_BENCHMARK(BM_FindTriggered_Ids);
+
+    void BM_FindTriggered_Parallel(State& state) {
+        // Generate the same knowledge base as BM_FindTriggered
+        auto settings = ConsultationSettings(1000, 1000);
+        auto knowledge_base = Generate(settings);
+        knowledge_base.facts_.ImportValues(knowledge_base.initial_values_);
+
+        // Test the Rules on one worker thread per hardware thread
+        utility::ThreadPool worker_pool;
+        for (auto _: state) {
+            DoNotOptimize(engines::inference::forward::FindTriggered(
+                    knowledge_base.facts_, knowledge_base.rules_, worker_pool));
+        }
+        state.SetLabel(Describe(settings) + " threads=" + std::to_string(worker_pool.Size()));
+    }
+    ESS_BENCHMARK(BM_FindTriggered_Parallel);
+
+    void BM_RunTriggered(State& state) {
+        // Find the Rules triggered by the initial session values
+        auto settings = ConsultationSettings(1000, 1000);
+        auto knowledge_base = Generate(settings);
+        knowledge_base.facts_.ImportValues(knowledge_base.initial_values_);
+        auto triggered_rules = engines::inference::forward::FindTriggered(knowledge_base.facts_, knowledge_base.rules_);
+
+        for (auto _: state) {
+            // Run the Rules on a fresh branch of the initial session values
+            auto fact_database = knowledge_base.facts_.Fork();
+            DoNotOptimize(engines::inference::forward::RunTriggered(triggered_rules, fact_database));
+        }
+        state.SetLabel(Describe(settings) + " triggered=" + std::to_string(triggered_rules.size()));
+    }
+    ESS_BENCHMARK(BM_RunTriggered);
+
+    void BM_RunTriggered_Phased(State& state) {
+        // Find the same Rules as BM_RunTriggered
+        auto settings = ConsultationSettings(1000, 1000);
+        auto knowledge_base = Generate(settings);
+        knowledge_base.facts_.ImportValues(knowledge_base.initial_values_);
+        auto triggered_rules = engines::inference::forward::FindTriggered(knowledge_base.facts_, knowledge_base.rules_);
+
+        // Check the Assignments on one worker thread per hardware thread, replaying them in order
+        utility::ThreadPool worker_pool;
+        std::vector<engines::inference::forward::WriteConflict> conflicts;
+        for (auto _: state) {
+            auto fact_database = knowledge_base.facts_.Fork();
+            DoNotOptimize(engines::inference::forward::RunTriggered(
+                    triggered_rules, fact_database, worker_pool,
+                    engines::inference::forward::WritePolicy::kSequential, conflicts));
+        }
+        state.SetLabel(Describe(settings) + " triggered=" + std::to_string(triggered_rules.size())
+                       + " conflicts=" + std::to_string(conflicts.size())
+                       + " threads=" + std::to_string(worker_pool.Size()));
+    }
+    ESS_BENCHMARK(BM_RunTriggered_Phased);
+
+    void BM_FindTriggered_ShortCircuit(State& state) {
+        // Generate the same knowledge base as BM_FindTriggered
+        auto settings = ConsultationSettings(1000, 1000);
+        auto knowledge_base = Generate(settings);
+        knowledge_base.facts_.ImportValues(knowledge_base.initial_values_);
+
+        for (auto _: state) {
+            DoNotOptimize(engines::inference::forward::FindTriggered(
+                    knowledge_base.facts_, knowledge_base.rules_, knowledge::rules::EvaluationMode::kShortCircuit));
+        }
+
+        // Report the share of Conditions that were skipped
+        std::size_t skipped_conditions = 0;
+        std::size_t total_conditions = 0;
+        for (auto& current_rule: knowledge_base.rules_.managed_rules_) {
+            skipped_conditions += current_rule.second.statistics_.skipped_conditions_;
+            total_conditions += current_rule.second.statistics_.tests_
+                    * (current_rule.second.trigger_.condition_chain_.size() + 1);
+        }
+        state.SetLabel(Describe(settings) + " skipped=" + std::to_string(skipped_conditions)
+                       + "/" + std::to_string(total_conditions));
+    }
+    ESS_BENCHMARK(BM_FindTriggered_ShortCircuit);
+
+    void BM_IdentifyFactRequests(State& state) {
+        // Generate a knowledge base with its initial session values
+        auto settings = ConsultationSettings(1000, 1000);
+        auto knowledge_base = Generate(settings);
+        knowledge_base.facts_.ImportValues(knowledge_base.initial_values_);
+
+        for (auto _: state) {
+            DoNotOptimize(engines::inference::forward::IdentifyFactRequests(
+                    knowledge_base.facts_, knowledge_base.rules_));
+        }
+        state.SetLabel(Describe(settings));
+    }
+    ESS_BENCHMARK(BM_IdentifyFactRequests);
+
+    void BM_Consultation_Scan_Small(State& state) {
+        Consultation(state, ConsultationSettings(100, 100), false);
+    }
+    ESS_BENCHMARK(BM_Consultation_Scan_Small);
+
+    void BM_Consultation_Scan_Large(State& state) {
+        Consultation(state, ConsultationSettings(1000, 1000), false);
+    }
+    ESS_BENCHMARK(BM_Consultation_Scan_Large);
+
+    void BM_Consultation_Network_Small(State& state) {
+        Consultation(state, ConsultationSettings(100, 100), true);
+    }
+    ESS_BENCHMARK(BM_Consultation_Network_Small);
+
+    void BM_Consultation_Network_Large(State& state) {
+        Consultation(state, ConsultationSettings(1000, 1000), true);
+    }
+    ESS_BENCHMARK(BM_Consultation_Network_Large);
+
+    void BM_Consultation_Agenda_Salience(State& state) {
+        Consultation(state, ConsultationSettings(1000, 1000), true, engines::inference::ConflictStrategy::kSalience);
+    }
+    ESS_BENCHMARK(BM_Consultation_Agenda_Salience);
+
+    void BM_Consultation_Agenda_Recency(State& state) {
+        Consultation(state, ConsultationSettings(1000, 1000), true, engines::inference::ConflictStrategy::kRecency);
+    }
+    ESS_BENCHMARK(BM_Consultation_Agenda_Recency);
+
+    void BM_JSON_SaveFactDatabase(State& state) {
+        auto settings = ConsultationSettings(1000, 0);
+        auto knowledge_base = Generate(settings);
+        for (auto _: state) {
+            nlohmann::json json_store = knowledge_base.facts_;
+            DoNotOptimize(json_store);
+        }
+        state.SetLabel(Describe(settings));
+    }
+    ESS_BENCHMARK(BM_JSON_SaveFactDatabase);
+
+    void BM_JSON_LoadFactDatabase(State& state) {
+        auto settings = ConsultationSettings(1000, 0);
+        nlohmann::json json_store = Generate(settings).facts_;
+        for (auto _: state) {
+            DoNotOptimize(json_store.get<knowledge::facts::FactDatabase>());
+        }
+        state.SetLabel(Describe(settings));
+    }
+    ESS_BENCHMARK(BM_JSON_LoadFactDatabase);
+
+    void BM_JSON_SaveRuleDatabase(State& state) {
+        auto settings = ConsultationSettings(1000, 1000);
+        auto knowledge_base = Generate(settings);
+        for (auto _: state) {
+            nlohmann::json json_store = knowledge_base.rules_;
+            DoNotOptimize(json_store);
+        }
+        state.SetLabel(Describe(settings));
+    }
+    ESS_BENCHMARK(BM_JSON_SaveRuleDatabase);
+
+    void BM_JSON_LoadRuleDatabase(State& state) {
+        auto settings = ConsultationSettings(1000, 1000);
+        nlohmann::json json_store = Generate(settings).rules_;
+        for (auto _: state) {
+            DoNotOptimize(json_store.get<knowledge::rules::RuleDatabase>());
+        }
+        state.SetLabel(Describe(settings));
+    }
+    ESS_BENCHMARK(BM_JSON_LoadRuleDatabase);
+
+    void BM_JSON_LoadKnowledgeBase(State& state) {
+        // Serialize both databases to text, as the GUI saves them
+        auto settings = ConsultationSettings(1000, 1000);
+        auto knowledge_base = Generate(settings);
+        nlohmann::json json_store;
+        json_store[utility::JSON_ID_DATABASE_FACTS] = knowledge_base.facts_;
+        json_store[utility::JSON_ID_DATABASE_RULES] = knowledge_base.rules_;
+        auto json_text = json_store.dump();
+
+        for (auto _: state) {
+            // Parse the text, then convert the databases
+            auto parsed_store = nlohmann::json::parse(json_text);
+            DoNotOptimize(parsed_store.at(utility::JSON_ID_DATABASE_FACTS).get<knowledge::facts::FactDatabase>());
+            DoNotOptimize(parsed_store.at(utility::JSON_ID_DATABASE_RULES).get<knowledge::rules::RuleDatabase>());
+        }
+        state.SetLabel(Describe(settings) + " bytes=" + std::to_string(json_text.size()));
+    }
+    ESS_BENCHMARK(BM_JSON_LoadKnowledgeBase);
+
+    void BM_Stream_LoadKnowledgeBase(State& state) {
+        // Serialize the same knowledge base as BM_JSON_LoadKnowledgeBase
+        auto settings = ConsultationSettings(1000, 1000);
+        auto knowledge_base = Generate(settings);
+        nlohmann::json json_store;
+        json_store[utility::JSON_ID_DATABASE_FACTS] = knowledge_base.facts_;
+        json_store[utility::JSON_ID_DATABASE_RULES] = knowledge_base.rules_;
+        auto json_text = json_store.dump();
+
+        for (auto _: state) {
+            // Stream the text into the databases, converting each Fact and Rule as it ends
+            std::istringstream json_stream(json_text);
+            knowledge::facts::FactDatabase fact_database;
+            knowledge::rules::RuleDatabase rule_database;
+            knowledge::stream::LoadError error;
+            DoNotOptimize(knowledge::stream::Load(json_stream, fact_database, rule_database, error));
+        }
+        state.SetLabel(Describe(settings) + " bytes=" + std::to_string(json_text.size()));
+    }
+    ESS_BENCHMARK(BM_Stream_LoadKnowledgeBase);
+
+    void BM_Binary_SaveKnowledgeBase(State& state) {
+        auto settings = ConsultationSettings(1000, 1000);
+        auto knowledge_base = Generate(settings);
+        for (auto _: state) {
+            DoNotOptimize(knowledge::binary::Encode(knowledge_base.facts_, knowledge_base.rules_));
+        }
+        state.SetLabel(Describe(settings));
+    }
+    ESS_BENCHMARK(BM_Binary_SaveKnowledgeBase);
+
+    void BM_Binary_LoadKnowledgeBase(State& state) {
+        // Encode the same knowledge base as BM_JSON_LoadKnowledgeBase
+        auto settings = ConsultationSettings(1000, 1000);
+        auto knowledge_base = Generate(settings);
+        auto bytes = knowledge::binary::Encode(knowledge_base.facts_, knowledge_base.rules_);
+
+        for (auto _: state) {
+            // View the bytes in place, then decode the databases
+            knowledge::binary::KnowledgeView view;
+            knowledge::facts::FactDatabase fact_database;
+            knowledge::rules::RuleDatabase rule_database;
+            view.Open(bytes.data(), bytes.size());
+            DoNotOptimize(knowledge::binary::Decode(view, fact_database, rule_database));
+        }
+        state.SetLabel(Describe(settings) + " bytes=" + std::to_string(bytes.size()));
+    }
+    ESS_BENCHMARK(BM_Binary_LoadKnowledgeBase);
+
+    void BM_DynamicEnum_NameToPosition(State& state) {
+        // Create an enum with 64 values
+        std::list<std::string> enum_names;
+        for (int position = 0; position < 64; ++position) {
+            enum_names.push_back("E" + std::to_string(position));
+        }
+        utility::DynamicEnum dynamic_enum(enum_names);
+        std::vector<std::string> lookups(enum_names.begin(), enum_names.end());
+
+        // Cycle through the names
+        std::size_t next_name = 0;
+        for (auto _: state) {
+            DoNotOptimize(dynamic_enum.At(lookups[next_name]));
+            next_name = (next_name + 1) % lookups.size();
+        }
+    }
+    ESS_BENCHMARK(BM_DynamicEnum_NameToPosition);
+
+    void BM_DynamicEnum_PositionToName(State& state) {
+        // Create an enum with 64 values
+        std::list<std::string> enum_names;
+        for (int position = 0; position < 64; ++position) {
+            enum_names.push_back("E" + std::to_string(position));
+        }
+        utility::DynamicEnum dynamic_enum(enum_names);
+
+        // Cycle through the positions
+        int next_position = 0;
+        for (auto _: state) {
+            DoNotOptimize(dynamic_enum.At(next_position));
+            next_position = (next_position + 1) % 64;
+        }
+    }
+    ESS_BENCHMARK(BM_DynamicEnum_PositionToName);
+
+    void BM_DynamicEnum_InsertRemove(State& state) {
+        // Create an enum with 4096 values, the size of a product code list
+        std::list<std::string> enum_names;
+        for (int position = 0; position < 4096; ++position) {
+            enum_names.push_back("E" + std::to_string(position));
+        }
+        utility::DynamicEnum dynamic_enum(enum_names);
+
+        // Insert a value near the front and remove it again, moving every value after it each time
+        const std::string inserted_name = "Inserted";
+        for (auto _: state) {
+            DoNotOptimize(dynamic_enum.Insert(inserted_name, 1));
+            DoNotOptimize(dynamic_enum.Remove(1));
+        }
+        state.SetLabel("values=4096");
+    }
+    ESS_BENCHMARK(BM_DynamicEnum_InsertRemove);
+
+} // namespace expert_system::bench
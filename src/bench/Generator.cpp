@@ -0,0 +1,254 @@
+#include "Generator.hpp"
+
+#include <list>
+#include <random>
+#include <vector>
+
+#include "knowledge/rules/Assignments.hpp"
+#include "knowledge/rules/Conditions.hpp"
+#include "utility/SymbolsJSON.hpp"
+
+namespace expert_system::bench {
+
+    namespace {
+
+            /**
+             * @brief Generates the name of an enum value.
+             * @param [in] position The position of the enum value.
+             * @return The name of the enum value.
+             */
+        std::string EnumName(std::size_t position) {
+            return "E" + std::to_string(position);
+        }
+
+            /// The pseudo-random sources used while generating a knowledge base.
+        struct Sources {
+                /// The pseudo-random generator.
+            std::mt19937 engine_;
+
+                /// Picks a Fact's type using the configured weights.
+            std::discrete_distribution<int> type_;
+
+                /// Picks the integer values used for Integer Facts.
+            std::uniform_int_distribution<int> int_value_{0, 100};
+
+                /// Picks the float values used for Float Facts.
+            std::uniform_real_distribution<float> float_value_{0.0f, 100.0f};
+
+                /// Picks a fair coin toss.
+            std::bernoulli_distribution coin_{0.5};
+        };
+
+            /**
+             * @brief Creates a Condition testing a Fact against a random target value.
+             * @param [in] fact_name The name of the target Fact.
+             * @param [in] type The Fact's type.
+             * @param [in] settings The shape of the knowledge base.
+             * @param [in] sources The pseudo-random sources.
+             * @return The Condition.
+             */
+        knowledge::rules::VariantCondition MakeCondition(const std::string& fact_name,
+                                                         utility::ExpertSystemTypes type,
+                                                         const GeneratorSettings& settings,
+                                                         Sources& sources) {
+            // Pick the comparison, Enum and Boolean Conditions only support equality
+            auto comparison = knowledge::rules::ConditionType::kEqualTo;
+            if ((type == utility::ExpertSystemTypes::kInt) || (type == utility::ExpertSystemTypes::kFloat)) {
+                comparison = sources.coin_(sources.engine_) ? knowledge::rules::ConditionType::kLessThan
+                                                            : knowledge::rules::ConditionType::kGreaterThan;
+            }
+            auto invert = sources.coin_(sources.engine_);
+
+            // Create the Condition for the Fact's type
+            knowledge::rules::VariantCondition condition(type);
+            switch (type) {
+                case utility::ExpertSystemTypes::kBool: {
+                    condition.condition_ = knowledge::rules::BoolCondition(
+                            fact_name, comparison, sources.coin_(sources.engine_), invert, 0.0f);
+                    break;
+                }
+                case utility::ExpertSystemTypes::kInt: {
+                    condition.condition_ = knowledge::rules::IntCondition(
+                            fact_name, comparison, sources.int_value_(sources.engine_), invert, 0.0f);
+                    break;
+                }
+                case utility::ExpertSystemTypes::kFloat: {
+                    condition.condition_ = knowledge::rules::FloatCondition(
+                            fact_name, comparison, sources.float_value_(sources.engine_), invert, 0.0f);
+                    break;
+                }
+                case utility::ExpertSystemTypes::kEnum: {
+                    std::uniform_int_distribution<std::size_t> position(0, settings.enum_size_ - 1);
+                    condition.condition_ = knowledge::rules::EnumCondition(
+                            fact_name, comparison, EnumName(position(sources.engine_)), invert, 0.0f);
+                    break;
+                }
+                default:
+                    break;
+            }
+            return condition;
+        }
+
+            /**
+             * @brief Creates an Assignment of a random value to a Fact.
+             * @param [in] fact_name The name of the target Fact.
+             * @param [in] type The Fact's type.
+             * @param [in] settings The shape of the knowledge base.
+             * @param [in] sources The pseudo-random sources.
+             * @return The Assignment.
+             */
+        knowledge::rules::VariantAssignment MakeAssignment(const std::string& fact_name,
+                                                           utility::ExpertSystemTypes type,
+                                                           const GeneratorSettings& settings,
+                                                           Sources& sources) {
+            knowledge::rules::VariantAssignment assignment(type);
+            switch (type) {
+                case utility::ExpertSystemTypes::kBool: {
+                    auto& raw_assignment = std::get<knowledge::rules::BoolAssignment>(assignment.assignment_);
+                    raw_assignment.fact_ = fact_name;
+                    raw_assignment.value_ = sources.coin_(sources.engine_);
+                    raw_assignment.confidence_factor_.Set(1.0f);
+                    break;
+                }
+                case utility::ExpertSystemTypes::kInt: {
+                    auto& raw_assignment = std::get<knowledge::rules::IntAssignment>(assignment.assignment_);
+                    raw_assignment.fact_ = fact_name;
+                    raw_assignment.value_ = sources.int_value_(sources.engine_);
+                    raw_assignment.confidence_factor_.Set(1.0f);
+                    break;
+                }
+                case utility::ExpertSystemTypes::kFloat: {
+                    auto& raw_assignment = std::get<knowledge::rules::FloatAssignment>(assignment.assignment_);
+                    raw_assignment.fact_ = fact_name;
+                    raw_assignment.value_ = sources.float_value_(sources.engine_);
+                    raw_assignment.confidence_factor_.Set(1.0f);
+                    break;
+                }
+                case utility::ExpertSystemTypes::kEnum: {
+                    std::uniform_int_distribution<std::size_t> position(0, settings.enum_size_ - 1);
+                    auto& raw_assignment = std::get<knowledge::rules::EnumAssignment>(assignment.assignment_);
+                    raw_assignment.fact_ = fact_name;
+                    raw_assignment.value_ = EnumName(position(sources.engine_));
+                    raw_assignment.confidence_factor_.Set(1.0f);
+                    break;
+                }
+                default:
+                    break;
+            }
+            return assignment;
+        }
+
+            /**
+             * @brief Creates a random initial session value for a Fact.
+             * @param [in] type The Fact's type.
+             * @param [in] settings The shape of the knowledge base.
+             * @param [in] sources The pseudo-random sources.
+             * @return The session value, in the format of FactDatabase::ImportValues().
+             */
+        nlohmann::json MakeValue(utility::ExpertSystemTypes type,
+                                 const GeneratorSettings& settings,
+                                 Sources& sources) {
+            nlohmann::json json_value;
+            json_value[utility::JSON_ID_CONFIDENCE] = 1.0f;
+            switch (type) {
+                case utility::ExpertSystemTypes::kBool: {
+                    json_value[utility::JSON_ID_VALUE] = sources.coin_(sources.engine_);
+                    break;
+                }
+                case utility::ExpertSystemTypes::kInt: {
+                    json_value[utility::JSON_ID_VALUE] = sources.int_value_(sources.engine_);
+                    break;
+                }
+                case utility::ExpertSystemTypes::kFloat: {
+                    json_value[utility::JSON_ID_VALUE] = sources.float_value_(sources.engine_);
+                    break;
+                }
+                case utility::ExpertSystemTypes::kEnum: {
+                    std::uniform_int_distribution<std::size_t> position(0, settings.enum_size_ - 1);
+                    json_value[utility::JSON_ID_VALUE] = EnumName(position(sources.engine_));
+                    break;
+                }
+                default:
+                    break;
+            }
+            return json_value;
+        }
+
+    } // namespace
+
+    KnowledgeBase Generate(const GeneratorSettings& settings) {
+        KnowledgeBase knowledge_base;
+        Sources sources{std::mt19937(settings.seed_),
+                        std::discrete_distribution<int>(settings.type_weights_.begin(),
+                                                        settings.type_weights_.end())};
+        const utility::ExpertSystemTypes type_options[] = {utility::ExpertSystemTypes::kBool,
+                                                           utility::ExpertSystemTypes::kInt,
+                                                           utility::ExpertSystemTypes::kFloat,
+                                                           utility::ExpertSystemTypes::kEnum};
+
+        // Create the Facts, giving the lowest indexed Facts an initial session value
+        std::list<std::string> enum_names;
+        for (std::size_t position = 0; position < settings.enum_size_; ++position) {
+            enum_names.push_back(EnumName(position));
+        }
+        std::vector<utility::ExpertSystemTypes> fact_types;
+        auto initial_count = (std::size_t) (settings.initial_fraction_ * (double) settings.fact_count_);
+        for (std::size_t fact_index = 0; fact_index < settings.fact_count_; ++fact_index) {
+            auto fact_name = "F" + std::to_string(fact_index);
+            auto type = type_options[sources.type_(sources.engine_)];
+            auto& created_fact = knowledge_base.facts_.Create(fact_name, type).value().get();
+            if (type == utility::ExpertSystemTypes::kEnum) {
+                std::get<knowledge::facts::EnumFact>(created_fact.fact_).enum_ = utility::DynamicEnum(enum_names);
+            }
+            fact_types.push_back(type);
+            if (fact_index < initial_count) {
+                knowledge_base.initial_values_[fact_name] = MakeValue(type, settings, sources);
+            }
+        }
+        if (settings.fact_count_ < 2) {
+            // Rules need at least one Fact to read and one to write
+            return knowledge_base;
+        }
+
+        // Create the Rules
+        std::uniform_int_distribution<int> connector(0, 2);
+        for (std::size_t rule_index = 0; rule_index < settings.rule_count_; ++rule_index) {
+            // Pick a split point, so the Rule reads Facts below it and writes Facts at or above it
+            std::uniform_int_distribution<std::size_t> split_position(1, settings.fact_count_ - 1);
+            auto split = split_position(sources.engine_);
+            std::uniform_int_distribution<std::size_t> read_position(0, split - 1);
+            std::uniform_int_distribution<std::size_t> write_position(split, settings.fact_count_ - 1);
+
+            // Create the Antecedent
+            knowledge::rules::Rule rule;
+            for (std::size_t condition_index = 0; condition_index < settings.chain_length_; ++condition_index) {
+                auto fact_index = read_position(sources.engine_);
+                auto condition = MakeCondition("F" + std::to_string(fact_index), fact_types[fact_index],
+                                               settings, sources);
+                if (condition_index == 0) {
+                    rule.trigger_.root_condition_ = condition;
+                } else {
+                    rule.trigger_.condition_chain_.emplace_back(
+                            (knowledge::rules::ConnectorType) connector(sources.engine_), condition);
+                }
+            }
+
+            // Create the Consequent
+            for (std::size_t assignment_index = 0; assignment_index < settings.assignment_count_; ++assignment_index) {
+                auto fact_index = write_position(sources.engine_);
+                rule.response_.assignments_.push_back(MakeAssignment("F" + std::to_string(fact_index),
+                                                                     fact_types[fact_index], settings, sources));
+            }
+            knowledge_base.rules_.Insert("R" + std::to_string(rule_index), rule);
+        }
+        return knowledge_base;
+    }
+
+    std::string Describe(const GeneratorSettings& settings) {
+        return "facts=" + std::to_string(settings.fact_count_)
+               + " rules=" + std::to_string(settings.rule_count_)
+               + " chain=" + std::to_string(settings.chain_length_)
+               + " enum=" + std::to_string(settings.enum_size_);
+    }
+
+} // namespace expert_system::bench
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "nlohmann/json.hpp"
+
+#include "knowledge/facts/FactDatabase.hpp"
+#include "knowledge/rules/RuleDatabase.hpp"
+
+namespace expert_system::bench {
+
+        /// The shape of a synthetic knowledge base.
+    struct GeneratorSettings {
+            /// The amount of Facts to create.
+        std::size_t fact_count_ = 100;
+
+            /// The amount of Rules to create.
+        std::size_t rule_count_ = 100;
+
+            /// The amount of Conditions in each Rule's Antecedent, including the root Condition.
+        std::size_t chain_length_ = 3;
+
+            /// The amount of Assignments in each Rule's Consequent.
+        std::size_t assignment_count_ = 1;
+
+            /// The relative weights of the Boolean, Integer, Float and Enum Fact types.
+        std::array<unsigned int, 4> type_weights_ = {1, 1, 1, 1};
+
+            /// The amount of enum values in each Enum Fact.
+        std::size_t enum_size_ = 8;
+
+            /// The fraction of the Facts that are given an initial session value.
+        double initial_fraction_ = 0.3;
+
+            /// The seed for the pseudo-random generator, the same seed always generates the same knowledge base.
+        std::uint32_t seed_ = 1;
+    };
+
+        /// A synthetic knowledge base, with a set of initial session values for a consultation.
+    struct KnowledgeBase {
+            /// The generated Facts, without any session values.
+        knowledge::facts::FactDatabase facts_;
+
+            /// The generated Rules.
+        knowledge::rules::RuleDatabase rules_;
+
+            /// Initial session values for a consultation, see FactDatabase::ImportValues().
+        nlohmann::json initial_values_;
+    };
+
+        /**
+         * @brief Generates a synthetic knowledge base.
+         * Facts are named "F<index>" and Rules "R<index>". Each Rule mostly reads lower indexed Facts
+         * and writes higher indexed Facts, so that consultations chain through several rounds of Rules.
+         * @param [in] settings The shape of the knowledge base.
+         * @return The generated knowledge base.
+         */
+    KnowledgeBase Generate(const GeneratorSettings& settings);
+
+        /**
+         * @brief Creates a short description of a knowledge base's shape, for labelling reports.
+         * @param [in] settings The shape of the knowledge base.
+         * @return The description.
+         */
+    std::string Describe(const GeneratorSettings& settings);
+
+} // namespace expert_system::bench
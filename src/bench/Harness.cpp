@@ -0,0 +1,213 @@
+#include "Harness.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+
+#include "nlohmann/json.hpp"
+
+#include "bench/Allocations.hpp"
+
+namespace expert_system::bench {
+
+    namespace {
+
+            /**
+             * @brief Gathers the current time of the monotonic clock.
+             * @return The time in nanoseconds.
+             */
+        std::int64_t Now() {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+            /**
+             * @brief Provides access to the registered benchmarks.
+             * @return A reference to the map of benchmark names to functions, sorted by name.
+             */
+        std::map<std::string, BenchmarkFunction>& Registry() {
+            static std::map<std::string, BenchmarkFunction> registry;
+            return registry;
+        }
+
+    } // namespace
+
+    State::State(std::size_t iterations) : iterations_(iterations) {}
+
+    void State::PauseTiming() {
+        // Accumulate the time and allocations since the timer was started
+        elapsed_ns_ += Now() - started_ns_;
+        allocations_ += AllocationCount() - started_allocations_;
+        allocated_bytes_ += AllocatedBytes() - started_allocated_bytes_;
+    }
+
+    void State::ResumeTiming() {
+        // Restart the timer and allocation counters
+        started_allocations_ = AllocationCount();
+        started_allocated_bytes_ = AllocatedBytes();
+        started_ns_ = Now();
+    }
+
+    void State::SetLabel(const std::string& label) {
+        label_ = label;
+    }
+
+    std::size_t State::Iterations() const {
+        return iterations_;
+    }
+
+    State::Iterator::Iterator(State* state, std::size_t remaining) : state_(state), remaining_(remaining) {}
+
+    State::Value State::Iterator::operator*() const {
+        return {};
+    }
+
+    State::Iterator& State::Iterator::operator++() {
+        --remaining_;
+        return *this;
+    }
+
+    bool State::Iterator::operator!=(const Iterator&) {
+        // Catch the final iteration, and stop the timer
+        if (remaining_ == 0) {
+            state_->Finish();
+            return false;
+        }
+        return true;
+    }
+
+    State::Iterator State::begin() {
+        // Start the timer with the first iteration
+        ResumeTiming();
+        return Iterator(this, iterations_);
+    }
+
+    State::Iterator State::end() {
+        return Iterator(nullptr, 0);
+    }
+
+    void State::Finish() {
+        // Stop the timer
+        PauseTiming();
+    }
+
+        /// Provides the runner with access to the State's results.
+    struct Runner {
+            /**
+             * @brief Runs a benchmark, increasing the iterations until it runs for the minimum time.
+             * @param [in] function The function that runs the benchmark.
+             * @param [in] minimum_seconds The minimum timed duration.
+             * @return The State of the final run.
+             */
+        static State Run(const BenchmarkFunction& function, double minimum_seconds) {
+            auto minimum_ns = (std::int64_t) (minimum_seconds * 1e9);
+            std::size_t iterations = 1;
+            while (true) {
+                // Run the benchmark
+                State state(iterations);
+                function(state);
+
+                // Catch if the benchmark ran for long enough, or cannot run any more iterations
+                if ((state.elapsed_ns_ >= minimum_ns) || (iterations >= 1000000000)) {
+                    return state;
+                }
+
+                // Estimate the iterations needed, overshooting slightly and growing by at most 10x
+                auto per_iteration_ns = std::max<double>((double) state.elapsed_ns_ / (double) iterations, 1.0);
+                auto estimate = (std::size_t) (1.4 * (double) minimum_ns / per_iteration_ns);
+                iterations = std::clamp<std::size_t>(estimate, iterations + 1, iterations * 10);
+            }
+        }
+
+            /**
+             * @brief Gathers the time taken per iteration.
+             * @param [in] state The State of a completed run.
+             * @return The average time per iteration, in nanoseconds.
+             */
+        static double NanosecondsPerIteration(const State& state) {
+            return (double) state.elapsed_ns_ / (double) state.iterations_;
+        }
+
+            /**
+             * @brief Gathers the allocations per iteration.
+             * @param [in] state The State of a completed run.
+             * @return The average amount of allocations per iteration.
+             */
+        static double AllocationsPerIteration(const State& state) {
+            return (double) state.allocations_ / (double) state.iterations_;
+        }
+
+            /**
+             * @brief Gathers the allocated bytes per iteration.
+             * @param [in] state The State of a completed run.
+             * @return The average amount of bytes allocated per iteration.
+             */
+        static double BytesPerIteration(const State& state) {
+            return (double) state.allocated_bytes_ / (double) state.iterations_;
+        }
+
+            /**
+             * @brief Gathers the State's label.
+             * @param [in] state The State of a completed run.
+             * @return A copy of the label.
+             */
+        static std::string Label(const State& state) {
+            return state.label_;
+        }
+    };
+
+    bool Register(const std::string& name, BenchmarkFunction function) {
+        Registry()[name] = std::move(function);
+        return true;
+    }
+
+    std::size_t RunAll(const std::string& filter, double minimum_seconds, bool json_format) {
+        // Print the table's header
+        if (!json_format) {
+            std::cout << std::left << std::setw(48) << "Benchmark"
+                      << std::right << std::setw(16) << "ns/op"
+                      << std::setw(14) << "allocs/op"
+                      << std::setw(14) << "bytes/op"
+                      << std::setw(14) << "iterations"
+                      << "  label" << std::endl;
+        }
+
+        // Run each of the benchmarks that match the filter
+        std::size_t benchmarks_run = 0;
+        nlohmann::json json_report = nlohmann::json::array();
+        for (auto& current_benchmark: Registry()) {
+            if (current_benchmark.first.find(filter) == std::string::npos) {
+                continue;
+            }
+            auto state = Runner::Run(current_benchmark.second, minimum_seconds);
+            ++benchmarks_run;
+
+            // Report the results
+            if (json_format) {
+                json_report.push_back({{"name", current_benchmark.first},
+                                       {"ns_per_op", Runner::NanosecondsPerIteration(state)},
+                                       {"allocs_per_op", Runner::AllocationsPerIteration(state)},
+                                       {"bytes_per_op", Runner::BytesPerIteration(state)},
+                                       {"iterations", state.Iterations()},
+                                       {"label", Runner::Label(state)}});
+            } else {
+                std::cout << std::left << std::setw(48) << current_benchmark.first
+                          << std::right << std::fixed << std::setprecision(1)
+                          << std::setw(16) << Runner::NanosecondsPerIteration(state)
+                          << std::setw(14) << Runner::AllocationsPerIteration(state)
+                          << std::setw(14) << Runner::BytesPerIteration(state)
+                          << std::setw(14) << state.Iterations()
+                          << "  " << Runner::Label(state) << std::endl;
+            }
+        }
+
+        // Print the JSON report all at once
+        if (json_format) {
+            std::cout << std::setw(4) << json_report << std::endl;
+        }
+        return benchmarks_run;
+    }
+
+} // namespace expert_system::bench
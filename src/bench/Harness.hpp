@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace expert_system::bench {
+
+        /**
+         * @brief The running state of a single benchmark, controlling how many iterations are timed.
+         * Used in the same way as a Google Benchmark state: `for (auto _ : state) { ... }`.
+         */
+    class State {
+    public:
+            /**
+             * @brief Parameterized constructor.
+             * @param [in] iterations The amount of iterations to run.
+             */
+        explicit State(std::size_t iterations);
+
+            /// Stops the timer and allocation counters, for excluding set-up work from an iteration.
+        void PauseTiming();
+
+            /// Restarts the timer and allocation counters after PauseTiming().
+        void ResumeTiming();
+
+            /**
+             * @brief Attaches a label to the benchmark's report.
+             * @param [in] label A short description, such as the size of the generated knowledge base.
+             */
+        void SetLabel(const std::string& label);
+
+            /**
+             * @brief Gathers the amount of iterations being run.
+             * @return The amount of iterations.
+             */
+        [[nodiscard]] std::size_t Iterations() const;
+
+            /// The unused loop variable, with a user-provided destructor so it is not reported as unused.
+        struct Value {
+                /// Destructor, does nothing.
+            ~Value() {}
+        };
+
+            /// A counting iterator, the loop body runs once for each iteration.
+        class Iterator {
+        public:
+                /**
+                 * @brief Parameterized constructor.
+                 * @param [in] state The owning State, or nullptr for the end iterator.
+                 * @param [in] remaining The amount of iterations left to run.
+                 */
+            Iterator(State* state, std::size_t remaining);
+
+                /// Dereferences to nothing, the loop variable is unused.
+            Value operator*() const;
+
+                /// Advances to the next iteration.
+            Iterator& operator++();
+
+                /// Stops the timer once no iterations remain.
+            bool operator!=(const Iterator& end);
+
+        private:
+                /// The owning State.
+            State* state_;
+
+                /// The amount of iterations left to run.
+            std::size_t remaining_;
+        };
+
+            /// Starts the timer and returns the first iteration.
+        Iterator begin();
+
+            /// Returns the end iteration.
+        Iterator end();
+
+    private:
+            /// Friend access for the runner to read the results.
+        friend struct Runner;
+
+            /// Stops the timer after the final iteration.
+        void Finish();
+
+            /// The amount of iterations to run.
+        std::size_t iterations_;
+
+            /// The total time spent in timed iterations, in nanoseconds.
+        std::int64_t elapsed_ns_ = 0;
+
+            /// The time that the timer was last started, in nanoseconds.
+        std::int64_t started_ns_ = 0;
+
+            /// The amount of allocations made in timed iterations.
+        std::uint64_t allocations_ = 0;
+
+            /// The amount of bytes allocated in timed iterations.
+        std::uint64_t allocated_bytes_ = 0;
+
+            /// The allocation counters when the timer was last started.
+        std::uint64_t started_allocations_ = 0;
+
+            /// The allocated byte counter when the timer was last started.
+        std::uint64_t started_allocated_bytes_ = 0;
+
+            /// The label to attach to the report.
+        std::string label_;
+    };
+
+        /// A function that runs a benchmark.
+    using BenchmarkFunction = std::function<void(State& state)>;
+
+        /**
+         * @brief Adds a benchmark to the suite.
+         * @param [in] name The unique name of the benchmark, used for filtering.
+         * @param [in] function The function that runs the benchmark.
+         * @return True, so this can be used to initialize a static variable.
+         */
+    bool Register(const std::string& name, BenchmarkFunction function);
+
+        /**
+         * @brief Runs each registered benchmark with a name containing the filter, and reports the results.
+         * The amount of iterations is increased until each benchmark runs for at least the minimum time.
+         * @param [in] filter A substring of the benchmark names to run, or an empty string to run all of them.
+         * @param [in] minimum_seconds The minimum timed duration of each benchmark.
+         * @param [in] json_format True to report in JSON format, False for a table.
+         * @return The amount of benchmarks that were run.
+         */
+    std::size_t RunAll(const std::string& filter, double minimum_seconds, bool json_format);
+
+        /**
+         * @brief Prevents the compiler from optimizing away a value that is never used.
+         * @tparam T The type of the value.
+         * @param [in] value The value to keep.
+         */
+    template<class T>
+    inline void DoNotOptimize(T&& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+} // namespace expert_system::bench
+
+    /// Registers a benchmark function, using its own name.
+#define ESS_BENCHMARK(function) \
+    static const bool ess_benchmark_registered_##function = \
+        expert_system::bench::Register(#function, function)
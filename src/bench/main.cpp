@@ -0,0 +1,31 @@
+#include <iostream>
+#include <string>
+
+#include "bench/Harness.hpp"
+
+int main(int argc, char *argv[]) {
+    // Gather the options
+    std::string filter;
+    double minimum_seconds = 0.5;
+    bool json_format = false;
+    for (int argument_index = 1; argument_index < argc; ++argument_index) {
+        std::string argument(argv[argument_index]);
+        if (argument.rfind("--min-time=", 0) == 0) {
+            minimum_seconds = std::stod(argument.substr(11));
+        } else if (argument == "--json") {
+            json_format = true;
+        } else if (argument.rfind("--", 0) == 0) {
+            std::cerr << "Usage: " << argv[0] << " [filter] [--min-time=seconds] [--json]" << std::endl;
+            return 1;
+        } else {
+            filter = argument;
+        }
+    }
+
+    // Run the benchmarks
+    if (expert_system::bench::RunAll(filter, minimum_seconds, json_format) == 0) {
+        std::cerr << "No benchmarks matched \"" << filter << "\"" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,313 @@
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "engines/explanation/Log.hpp"
+#include "engines/explanation/LogSink.hpp"
+#include "engines/explanation/NdjsonSink.hpp"
+#include "engines/explanation/TraceStore.hpp"
+#include "engines/inference/Agenda.hpp"
+#include "engines/inference/Batch.hpp"
+#include "engines/inference/Forward.hpp"
+#include "engines/profiling/Profiler.hpp"
+#include "knowledge/BinaryFormat.hpp"
+#include "knowledge/StreamLoader.hpp"
+#include "knowledge/facts/FactDatabase.hpp"
+#include "knowledge/rules/RuleDatabase.hpp"
+#include "utility/SymbolsJSON.hpp"
+
+    /**
+     * @brief Attempts to parse a JSON object from a file, or from stdin.
+     * @param [in] file_name The name of the file, or "-" for stdin.
+     * @param [out] json_store The parsed JSON object.
+     * @return True if the JSON object was parsed, False otherwise.
+     */
+bool ReadJSON(const std::string& file_name, nlohmann::json& json_store) {
+    // Catch a request to read from stdin
+    if (file_name == "-") {
+        json_store = nlohmann::json::parse(std::cin, nullptr, false);
+        return !json_store.is_discarded();
+    }
+
+    // Attempt to open the requested file
+    std::ifstream file_stream(file_name, std::ifstream::in);
+    if (!file_stream.is_open()) {
+        // Catch the error and indicate failure
+        std::cerr << "Unable to open file \"" << file_name << "\"" << std::endl;
+        return false;
+    }
+
+    // Parse the file data into a JSON object
+    json_store = nlohmann::json::parse(file_stream, nullptr, false);
+    return !json_store.is_discarded();
+}
+
+    /**
+     * @brief Attempts to write a JSON object to a file.
+     * @param [in] file_name The name of the file.
+     * @param [in] json_store The JSON object to write.
+     * @return True if the file was written, False otherwise.
+     */
+bool WriteJSON(const std::string& file_name, const nlohmann::json& json_store) {
+    // Attempt to open the requested file
+    std::ofstream file_stream(file_name, std::ofstream::out);
+    if (!file_stream.is_open()) {
+        // Catch the error and indicate failure
+        std::cerr << "Unable to open file \"" << file_name << "\"" << std::endl;
+        return false;
+    }
+
+    // Write the JSON object
+    file_stream << std::setw(4) << json_store << std::endl;
+    return true;
+}
+
+    /**
+     * @brief Attempts to load an expert system, from either a binary knowledge base or the GUI's JSON format.
+     * @param [in] file_name The name of the file, or "-" for JSON from stdin.
+     * @param [out] fact_database The loaded Facts.
+     * @param [out] rule_database The loaded Rules.
+     * @return True if the expert system was loaded, False otherwise.
+     */
+bool ReadExpertSystem(const std::string& file_name,
+                      expert_system::knowledge::facts::FactDatabase& fact_database,
+                      expert_system::knowledge::rules::RuleDatabase& rule_database) {
+    // Map and decode a binary knowledge base in place
+    if ((file_name != "-") && expert_system::knowledge::binary::IsBinaryFile(file_name)) {
+        auto outcome = expert_system::knowledge::binary::Load(file_name, fact_database, rule_database);
+        if (outcome != expert_system::knowledge::binary::BinaryOutcome::kSuccess) {
+            std::cerr << "Could not load the binary knowledge base from \"" << file_name << "\": "
+                      << nlohmann::json(outcome).get<std::string>() << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    // Otherwise stream the JSON format, without building a document of the whole file
+    expert_system::knowledge::stream::LoadError error;
+    bool loaded = (file_name == "-")
+            ? expert_system::knowledge::stream::Load(std::cin, fact_database, rule_database, error)
+            : expert_system::knowledge::stream::Load(file_name, fact_database, rule_database, error);
+    if (!loaded) {
+        std::cerr << "Could not load the expert system from \"" << file_name << "\": "
+                  << error.Describe() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+    /**
+     * @brief Converts an expert system between the GUI's JSON format and a binary knowledge base.
+     * @param [in] input_name The name of the file to convert, its format is detected from its contents.
+     * @param [in] output_name The name of the file to write, in the other format.
+     * @return The process exit code.
+     */
+int Convert(const std::string& input_name, const std::string& output_name) {
+    // Convert a binary knowledge base into the JSON format
+    if ((input_name != "-") && expert_system::knowledge::binary::IsBinaryFile(input_name)) {
+        nlohmann::json json_store;
+        auto outcome = expert_system::knowledge::binary::ConvertToJSON(input_name, json_store);
+        if (outcome != expert_system::knowledge::binary::BinaryOutcome::kSuccess) {
+            std::cerr << "Could not load the binary knowledge base from \"" << input_name << "\": "
+                      << nlohmann::json(outcome).get<std::string>() << std::endl;
+            return 1;
+        }
+        std::ofstream file_stream(output_name, std::ofstream::out);
+        if (!file_stream.is_open()) {
+            std::cerr << "Unable to open file \"" << output_name << "\"" << std::endl;
+            return 1;
+        }
+        file_stream << std::setw(4) << json_store << std::endl;
+        return 0;
+    }
+
+    // Convert the JSON format into a binary knowledge base
+    expert_system::knowledge::facts::FactDatabase fact_database;
+    expert_system::knowledge::rules::RuleDatabase rule_database;
+    if (!ReadExpertSystem(input_name, fact_database, rule_database)) {
+        return 1;
+    }
+    if (!expert_system::knowledge::binary::Save(output_name, fact_database, rule_database)) {
+        std::cerr << "Could not write the binary knowledge base to \"" << output_name << "\"" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    // Separate the options from the positional arguments
+    std::vector<std::string> arguments;
+    std::optional<expert_system::engines::inference::ConflictStrategy> strategy;
+    bool convert = false;
+    std::optional<std::string> profile_name;
+    std::optional<std::string> trace_name;
+    std::optional<std::string> events_name;
+    const std::string strategy_option = "--strategy=";
+    const std::string convert_option = "--convert";
+    const std::string profile_option = "--profile=";
+    const std::string trace_option = "--trace=";
+    const std::string events_option = "--events=";
+    for (int argument_index = 1; argument_index < argc; ++argument_index) {
+        std::string current_argument(argv[argument_index]);
+        if (current_argument == convert_option) {
+            // Convert the expert system instead of running a consultation
+            convert = true;
+        } else if (current_argument.rfind(strategy_option, 0) == 0) {
+            // Parse the conflict resolution strategy by name
+            strategy = nlohmann::json(current_argument.substr(strategy_option.size()))
+                    .get<expert_system::engines::inference::ConflictStrategy>();
+            if (strategy == expert_system::engines::inference::ConflictStrategy::kUnknown) {
+                std::cerr << "Unknown conflict resolution strategy \"" << current_argument << "\"" << std::endl;
+                return 1;
+            }
+        } else if (current_argument.rfind(profile_option, 0) == 0) {
+            // Export the consultation's counters and phase times
+            profile_name = current_argument.substr(profile_option.size());
+        } else if (current_argument.rfind(trace_option, 0) == 0) {
+            // Export the consultation's phases as Chrome trace events
+            trace_name = current_argument.substr(trace_option.size());
+        } else if (current_argument.rfind(events_option, 0) == 0) {
+            // Stream the consultation's events to a file as they happen
+            events_name = current_argument.substr(events_option.size());
+        } else {
+            arguments.push_back(current_argument);
+        }
+    }
+
+    // Catch invalid usage
+    if ((convert && (arguments.size() != 2)) || arguments.empty() || (arguments.size() > 3)) {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--strategy=Salience|Recency|Specificity|Confidence]"
+                  << " [--profile=profile.json] [--trace=trace.json] [--events=events.ndjson]"
+                  << " <expert_system.json|.eskb> [initial_values.json|-] [output.json]" << std::endl
+                  << "       " << argv[0] << " --convert <expert_system.json|.eskb> <output.eskb|.json>" << std::endl;
+        return 1;
+    }
+
+    // Catch a request to convert the expert system
+    if (convert) {
+        return Convert(arguments[0], arguments[1]);
+    }
+
+    // Load the expert system, in either the binary format or the same format as the GUI's saved files
+    expert_system::knowledge::facts::FactDatabase fact_database;
+    expert_system::knowledge::rules::RuleDatabase rule_database;
+    if (!ReadExpertSystem(arguments[0], fact_database, rule_database)) {
+        return 1;
+    }
+
+    // Read the initial session values, if provided
+    nlohmann::json json_values = nlohmann::json::object();
+    if (arguments.size() >= 2) {
+        if (!ReadJSON(arguments[1], json_values)) {
+            std::cerr << "Could not parse the initial values from \"" << arguments[1] << "\"" << std::endl;
+            return 1;
+        }
+    }
+
+    nlohmann::json json_output = nlohmann::json::object();
+    if (json_values.is_array()) {
+        // Catch measurements that can only be taken of a single consultation
+        if (profile_name.has_value() || trace_name.has_value()) {
+            std::cerr << "The --profile= and --trace= options cannot be used with an array of cases" << std::endl;
+            return 1;
+        }
+
+        // Catch an event stream, as the cases' events would be interleaved
+        if (events_name.has_value()) {
+            std::cerr << "The --events= option cannot be used with an array of cases" << std::endl;
+            return 1;
+        }
+
+        // Run an independent consultation for each case in parallel
+        auto case_results = expert_system::engines::inference::batch::RunCases(
+                fact_database,
+                rule_database,
+                json_values.get<std::vector<nlohmann::json>>(),
+                0,
+                strategy);
+        json_output[expert_system::utility::JSON_ID_CASES] = case_results;
+    } else {
+        // Assign the initial session values
+        for (const auto& current_fact_name: fact_database.ImportValues(json_values)) {
+            // Warn about, but skip, the session values that could not be assigned
+            std::cerr << "Warning: could not assign a session value to \"" << current_fact_name << "\""
+                      << std::endl;
+        }
+
+        // Keep the events in memory, unless they are streamed to a file
+        std::optional<expert_system::engines::explanation::NdjsonSink> events_sink;
+        expert_system::engines::explanation::TraceStore trace(rule_database);
+        expert_system::engines::explanation::LogSink* active_sink = &trace;
+        if (events_name.has_value()) {
+            events_sink.emplace(events_name.value());
+            if (!events_sink->IsOpen()) {
+                std::cerr << "Unable to open file \"" << events_name.value() << "\"" << std::endl;
+                return 1;
+            }
+            active_sink = &events_sink.value();
+        }
+
+        // Log the initial session values, credited to the user
+        active_sink->Write({expert_system::engines::inference::forward::LogExisting(fact_database)}, fact_database);
+
+        // Run the consultation without requesting any additional session values, measuring it if requested
+        expert_system::engines::profiling::Profiler profiler;
+        auto active_profiler = (profile_name.has_value() || trace_name.has_value()) ? &profiler : nullptr;
+        expert_system::engines::inference::MatchNetwork match_network(rule_database);
+        if (strategy.has_value()) {
+            // Run the Rules one at a time, in the order of the strategy's Agenda
+            expert_system::engines::inference::Agenda agenda(strategy.value());
+            expert_system::engines::inference::forward::RunToCompletion(
+                    fact_database,
+                    match_network,
+                    agenda,
+                    *active_sink,
+                    active_profiler);
+        } else {
+            // Run the triggered Rules in rounds
+            expert_system::engines::inference::forward::RunToCompletion(
+                    fact_database,
+                    rule_database,
+                    match_network,
+                    *active_sink,
+                    active_profiler);
+        }
+
+        // Export the recorded steps, if they were kept in memory
+        if (!events_sink.has_value()) {
+            std::vector<std::vector<expert_system::engines::explanation::Log>> logged_events;
+            for (std::size_t step_index = 0; step_index < trace.StepCount(); ++step_index) {
+                logged_events.push_back(trace.Logs(step_index, fact_database));
+            }
+            json_output[expert_system::utility::JSON_ID_EVENTS] = logged_events;
+        }
+
+        // Export the measurements, if requested
+        if (profile_name.has_value() && !WriteJSON(profile_name.value(), profiler)) {
+            return 1;
+        }
+        if (trace_name.has_value() && !WriteJSON(trace_name.value(), profiler.TraceEvents())) {
+            return 1;
+        }
+    }
+
+    // Export the results
+    if (arguments.size() >= 3) {
+        // Attempt to open the requested file
+        std::ofstream file_stream(arguments[2], std::ofstream::out);
+        if (!file_stream.is_open()) {
+            std::cerr << "Unable to open file \"" << arguments[2] << "\"" << std::endl;
+            return 1;
+        }
+        file_stream << std::setw(4) << json_output << std::endl;
+    } else {
+        std::cout << std::setw(4) << json_output << std::endl;
+    }
+    return 0;
+}
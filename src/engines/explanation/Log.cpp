@@ -1,7 +1,21 @@
 #include "Log.hpp"
 
+#include "utility/SymbolsJSON.hpp"
+
 namespace expert_system::engines::explanation {
 
-    Log::Log() : rule_(std::nullopt) {}
+    Log::Log() : rule_(std::nullopt), rule_id_(std::nullopt) {}
+
+    void to_json(nlohmann::json& json_sys, const Log& target) {
+        // Export the name of the Rule that caused the event, if any
+        if (target.rule_.has_value()) {
+            json_sys[utility::JSON_ID_RULE] = target.rule_.value()->first;
+        } else {
+            json_sys[utility::JSON_ID_RULE] = nullptr;
+        }
+
+        // Export the assigned session Values
+        json_sys[utility::JSON_ID_ASSIGNMENTS] = target.assignments_;
+    }
 
 } // namespace expert_system::engines::explanation
@@ -4,9 +4,12 @@
 #include <map>
 #include <string>
 
+#include "nlohmann/json.hpp"
+
 #include "knowledge/facts/Facts.hpp"
 #include "knowledge/facts/Values.hpp"
 #include "knowledge/rules/Rule.hpp"
+#include "knowledge/rules/RuleId.hpp"
 
 namespace expert_system::engines::explanation {
 
@@ -17,7 +20,7 @@ namespace expert_system::engines::explanation {
     struct Log {
             /**
              * @brief Default constructor.
-             * Sets rule_ to std::nullopt.
+             * Sets rule_ and rule_id_ to std::nullopt.
              */
         Log();
 
@@ -32,6 +35,20 @@ namespace expert_system::engines::explanation {
              * @note Contains std::nullopt if the event was caused by a user.
              */
         std::optional<std::map<std::string, knowledge::rules::Rule>::iterator> rule_;
+
+            /**
+             * @brief Stores the RuleId of the Rule that caused the Event.
+             * @note Only set by the APIs that refer to Rules by RuleId, see RuleDatabase::Id().
+             */
+        std::optional<knowledge::rules::RuleId> rule_id_;
     };
 
+        /**
+         * @brief Log serialization to JSON format.
+         * @param [in,out] json_sys A reference to a JSON object.
+         * @param [in] target A reference to the Log to export.
+         * @note The Rule is exported by name, or as null if the event was caused by a user.
+         */
+    void to_json(nlohmann::json& json_sys, const Log& target);
+
 } // namespace expert_system::engines::explanation
@@ -0,0 +1,17 @@
+#include "LogSink.hpp"
+
+namespace expert_system::engines::explanation {
+
+    void LogSink::Write(const std::vector<Log>& logs, const knowledge::facts::FactDatabase& fact_database) {
+        // Record each Log as an event of a new step
+        BeginStep();
+        for (const auto& current_log: logs) {
+            // Record the session value of each of the Log's Facts
+            BeginEvent(current_log.rule_);
+            for (const auto& current_assignment: current_log.assignments_) {
+                Record(current_assignment.first, fact_database);
+            }
+        }
+    }
+
+} // namespace expert_system::engines::explanation
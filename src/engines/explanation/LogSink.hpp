@@ -0,0 +1,58 @@
+#pragma once
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "engines/explanation/Log.hpp"
+#include "knowledge/facts/FactDatabase.hpp"
+#include "knowledge/rules/Rule.hpp"
+
+namespace expert_system::engines::explanation {
+
+        /**
+         * @brief A destination for the events of a consultation, as they happen.
+         * Each step of the consultation contains events, and each event is caused by a Rule or by the user.
+         * See TraceStore to keep the events in memory, or NdjsonSink to stream them to a file.
+         */
+    class LogSink {
+    public:
+            /// Type definition for the iterator to a Rule that caused an event.
+        using RuleIterator = std::map<std::string, knowledge::rules::Rule>::iterator;
+
+            /// Virtual destructor, for derived sinks.
+        virtual ~LogSink() = default;
+
+            /// Starts a new step, subsequent events are added to it.
+        virtual void BeginStep() = 0;
+
+            /**
+             * @brief Starts a new event in the current step, subsequent session values are added to it.
+             * @param [in] rule The iterator to the Rule that caused the event, or std::nullopt if it was caused by a user.
+             * @note A step is started if there is none.
+             */
+        virtual void BeginEvent(std::optional<RuleIterator> rule) = 0;
+
+            /**
+             * @brief Records the current session value of a Fact in the current event.
+             * @param [in] fact_name The name of the Fact.
+             * @param [in] fact_database The FactDatabase to gather the session value from.
+             * @warning An event must have been started!
+             */
+        virtual void Record(const std::string& fact_name, const knowledge::facts::FactDatabase& fact_database) = 0;
+
+            /// Writes out any buffered events, the default has nothing to write.
+        virtual void Flush() {}
+
+            /**
+             * @brief Records a set of Logs as a new step, with an event for each Log.
+             * @param [in] logs The Logs to record.
+             * @param [in] fact_database The FactDatabase that the Logs' session values were gathered from.
+             * @note By default the session values are gathered from the FactDatabase again, so this must be called
+             * before the Facts are assigned again.
+             */
+        virtual void Write(const std::vector<Log>& logs, const knowledge::facts::FactDatabase& fact_database);
+    };
+
+} // namespace expert_system::engines::explanation
@@ -0,0 +1,110 @@
+#include "NdjsonSink.hpp"
+
+#include "utility/SymbolsJSON.hpp"
+
+namespace expert_system::engines::explanation {
+
+    NdjsonSink::NdjsonSink(std::ostream& output_stream)
+        : output_stream_(&output_stream), last_write_(std::chrono::steady_clock::now()) {}
+
+    NdjsonSink::NdjsonSink(const std::string& file_name)
+        : file_stream_(file_name, std::ofstream::out), output_stream_(&file_stream_),
+          last_write_(std::chrono::steady_clock::now()) {}
+
+    NdjsonSink::~NdjsonSink() {
+        // Make sure nothing is lost
+        Flush();
+    }
+
+    bool NdjsonSink::IsOpen() const {
+        // A provided stream is always considered open
+        return (output_stream_ != &file_stream_) || file_stream_.is_open();
+    }
+
+    std::size_t NdjsonSink::EventCount() const {
+        // Provide the amount of events
+        return event_count_;
+    }
+
+    void NdjsonSink::BeginStep() {
+        // Finish the previous step's last event
+        BufferEvent();
+        ++step_count_;
+    }
+
+    void NdjsonSink::BeginEvent(std::optional<RuleIterator> rule) {
+        // Start a step if there is none, otherwise finish the previous event
+        if (step_count_ == 0) {
+            BeginStep();
+        } else {
+            BufferEvent();
+        }
+
+        // Start the event with its step and the name of the Rule that caused it, if any
+        current_event_ = nlohmann::json::object();
+        (*current_event_)[utility::JSON_ID_STEP] = step_count_ - 1;
+        if (rule.has_value()) {
+            (*current_event_)[utility::JSON_ID_RULE] = rule.value()->first;
+        } else {
+            (*current_event_)[utility::JSON_ID_RULE] = nullptr;
+        }
+        (*current_event_)[utility::JSON_ID_ASSIGNMENTS] = nlohmann::json::object();
+        ++event_count_;
+    }
+
+    void NdjsonSink::Record(const std::string& fact_name, const knowledge::facts::FactDatabase& fact_database) {
+        // Add the Fact's current session value to the event
+        (*current_event_)[utility::JSON_ID_ASSIGNMENTS][fact_name] = fact_database.GetVariantValue(fact_name);
+    }
+
+    void NdjsonSink::Write(const std::vector<Log>& logs, const knowledge::facts::FactDatabase& /*fact_database*/) {
+        // Record each Log as an event of a new step, keeping the Log's own session values
+        BeginStep();
+        for (const auto& current_log: logs) {
+            BeginEvent(current_log.rule_);
+            (*current_event_)[utility::JSON_ID_ASSIGNMENTS] = current_log.assignments_;
+        }
+    }
+
+    void NdjsonSink::Flush() {
+        // Write out the current event with the rest of the buffer
+        BufferEvent();
+        WriteBuffer();
+    }
+
+    void NdjsonSink::BufferEvent() {
+        // Catch if there is no event to finish
+        if (!current_event_.has_value()) {
+            return;
+        }
+
+        // Add the event to the buffer as a single line
+        buffer_ += current_event_->dump();
+        buffer_ += '\n';
+        current_event_.reset();
+        ++buffered_events_;
+
+        // Write the buffer out once enough events or time have accumulated
+        if ((buffered_events_ >= kFlushEvents)
+            || (std::chrono::steady_clock::now() - last_write_ >= kFlushInterval)) {
+            WriteBuffer();
+        }
+    }
+
+    void NdjsonSink::WriteBuffer() {
+        // Catch if there is nothing to write to
+        last_write_ = std::chrono::steady_clock::now();
+        if (!IsOpen()) {
+            buffer_.clear();
+            buffered_events_ = 0;
+            return;
+        }
+
+        // Write the lines, and push them through to the file so they can be followed
+        output_stream_->write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        output_stream_->flush();
+        buffer_.clear();
+        buffered_events_ = 0;
+    }
+
+} // namespace expert_system::engines::explanation
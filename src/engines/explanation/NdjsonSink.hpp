@@ -0,0 +1,129 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "engines/explanation/Log.hpp"
+#include "engines/explanation/LogSink.hpp"
+#include "knowledge/facts/FactDatabase.hpp"
+
+namespace expert_system::engines::explanation {
+
+        /**
+         * @brief A LogSink that streams each event as a line of JSON (NDJSON), for long-running consultations.
+         * Each line is an object with the step's index, the name of the Rule that caused the event (or null for the
+         * user), and the assigned session values, matching the format of an exported Log.
+         * Lines are buffered, and written out once enough events are buffered or enough time has passed,
+         * so that the events can be followed while the consultation is still running.
+         * @note Nothing is kept once written, so memory use does not grow with the length of the consultation.
+         */
+    class NdjsonSink : public LogSink {
+    public:
+            /// The amount of buffered events that causes the buffer to be written out.
+        static constexpr std::size_t kFlushEvents = 64;
+
+            /// The time since the last write that causes the buffer to be written out.
+        static constexpr std::chrono::milliseconds kFlushInterval{1000};
+
+            /**
+             * @brief Parameterized constructor, streams to an existing output stream.
+             * @param [in] output_stream The stream to write the lines to, which must outlive the NdjsonSink.
+             */
+        explicit NdjsonSink(std::ostream& output_stream);
+
+            /**
+             * @brief Parameterized constructor, streams to a file.
+             * @param [in] file_name The name of the file to create, replacing any existing file.
+             * @note Check IsOpen() to find if the file could be created.
+             */
+        explicit NdjsonSink(const std::string& file_name);
+
+            /// Destructor, writes out any buffered events.
+        ~NdjsonSink() override;
+
+            /// Use of copy or assignment constructors is not allowed.
+        NdjsonSink(const NdjsonSink&) = delete;
+
+            /// Use of copy or assignment constructors is not allowed.
+        NdjsonSink& operator=(const NdjsonSink&) = delete;
+
+            /**
+             * @brief Checks if the NdjsonSink has a stream to write to.
+             * @return True if the file was created, or a stream was provided, False otherwise.
+             */
+        [[nodiscard]] bool IsOpen() const;
+
+            /**
+             * @brief Gathers the amount of events written so far.
+             * @return The amount of lines, including any that are still buffered.
+             */
+        [[nodiscard]] std::size_t EventCount() const;
+
+            /// Starts a new step, subsequent events are added to it.
+        void BeginStep() override;
+
+            /**
+             * @brief Starts a new event in the current step, subsequent session values are added to it.
+             * @param [in] rule The iterator to the Rule that caused the event, or std::nullopt if it was caused by a user.
+             * @note A step is started if there is none, and the previous event is buffered.
+             */
+        void BeginEvent(std::optional<RuleIterator> rule) override;
+
+            /**
+             * @brief Records the current session value of a Fact in the current event.
+             * @param [in] fact_name The name of the Fact.
+             * @param [in] fact_database The FactDatabase to gather the session value from.
+             * @warning An event must have been started!
+             */
+        void Record(const std::string& fact_name, const knowledge::facts::FactDatabase& fact_database) override;
+
+            /**
+             * @brief Records a set of Logs as a new step, with an event for each Log.
+             * @param [in] logs The Logs to record.
+             * @param [in] fact_database Unused, the session values are copied from the Logs.
+             */
+        void Write(const std::vector<Log>& logs, const knowledge::facts::FactDatabase& fact_database) override;
+
+            /// Buffers the current event, and writes out every buffered event.
+        void Flush() override;
+
+    private:
+            /// Moves the current event into the buffer, writing the buffer out if it is due.
+        void BufferEvent();
+
+            /// Writes the buffer to the stream.
+        void WriteBuffer();
+
+            /// The file created by the NdjsonSink, if it was not given a stream.
+        std::ofstream file_stream_;
+
+            /// The stream to write the lines to.
+        std::ostream* output_stream_;
+
+            /// The lines that have not been written yet.
+        std::string buffer_;
+
+            /// The amount of events in the buffer.
+        std::size_t buffered_events_ = 0;
+
+            /// The amount of events, including the current one.
+        std::size_t event_count_ = 0;
+
+            /// The amount of steps started.
+        std::size_t step_count_ = 0;
+
+            /// The event that is still being recorded, if any.
+        std::optional<nlohmann::json> current_event_;
+
+            /// The time the buffer was last written.
+        std::chrono::steady_clock::time_point last_write_;
+    };
+
+} // namespace expert_system::engines::explanation
@@ -0,0 +1,345 @@
+#include "TraceStore.hpp"
+
+#include <functional>
+
+namespace expert_system::engines::explanation {
+
+    TraceStore::TraceStore(knowledge::rules::RuleDatabase& rule_database) : rule_database_(&rule_database) {}
+
+    void TraceStore::BeginStep() {
+        // The step's events start after the existing ones
+        steps_.push_back(events_.size());
+    }
+
+    void TraceStore::BeginEvent(std::optional<RuleIterator> rule) {
+        // Start a step if there is none
+        if (steps_.empty()) {
+            BeginStep();
+        }
+
+        // The event's records start after the existing ones, and are credited to the Rule's RuleId
+        auto source = kUserSource;
+        if (rule.has_value()) {
+            source = rule_database_->Id(rule.value()->first).value_or(kUserSource);
+        }
+        events_.push_back(Event{source, size_});
+    }
+
+    void TraceStore::Record(const std::string& fact_name, const knowledge::facts::FactDatabase& fact_database) {
+        // Catch a Fact that is not in the FactDatabase, keeping its name
+        auto& new_record = Append();
+        auto fact_handle = fact_database.Handle(fact_name);
+        if (!fact_handle.has_value()) {
+            new_record.unresolved_name_ = static_cast<std::uint32_t>(unresolved_names_.size());
+            unresolved_names_.push_back(fact_name);
+            return;
+        }
+        new_record.fact_ = fact_handle.value();
+
+        // Catch a Fact without a session value
+        auto found_fact = fact_database.Find(fact_handle.value());
+        if (!found_fact.has_value() || !fact_database.Known(fact_handle.value())) {
+            return;
+        }
+
+        // Copy the raw session value, based on the Fact's type
+        switch (found_fact->get().type_) {
+            case utility::ExpertSystemTypes::kBool: {
+                // Copy the raw value and its metadata
+                auto stored_value = fact_database.GetValue<bool>(fact_handle.value()).value();
+                new_record.value_ = stored_value.value_;
+                new_record.confidence_ = stored_value.confidence_factor_.Get();
+                new_record.timestamp_ = stored_value.timestamp_;
+                break;
+            }
+            case utility::ExpertSystemTypes::kInt: {
+                // Copy the raw value and its metadata
+                auto stored_value = fact_database.GetValue<int>(fact_handle.value()).value();
+                new_record.value_ = stored_value.value_;
+                new_record.confidence_ = stored_value.confidence_factor_.Get();
+                new_record.timestamp_ = stored_value.timestamp_;
+                break;
+            }
+            case utility::ExpertSystemTypes::kEnum: {
+                // Copy the raw value's EnumId and its metadata, so that it survives edits to the DynamicEnum
+                auto stored_value = fact_database.GetValue<int>(fact_handle.value()).value();
+                auto enum_id = std::get<knowledge::facts::EnumFact>(found_fact->get().fact_).enum_.Id(stored_value.value_);
+                if (!enum_id.has_value()) {
+                    return;
+                }
+                new_record.value_ = enum_id.value();
+                new_record.confidence_ = stored_value.confidence_factor_.Get();
+                new_record.timestamp_ = stored_value.timestamp_;
+                break;
+            }
+            case utility::ExpertSystemTypes::kFloat: {
+                // Copy the raw value and its metadata
+                auto stored_value = fact_database.GetValue<float>(fact_handle.value()).value();
+                new_record.value_ = stored_value.value_;
+                new_record.confidence_ = stored_value.confidence_factor_.Get();
+                new_record.timestamp_ = stored_value.timestamp_;
+                break;
+            }
+            default: {
+                // Leave the session value unknown
+                return;
+            }
+        }
+
+        // Store the type
+        new_record.type_ = found_fact->get().type_;
+    }
+
+    void TraceStore::Record(const Log& log, const knowledge::facts::FactDatabase& fact_database) {
+        // Start the Log's event
+        BeginEvent(log.rule_);
+
+        // Copy each of the Log's session values
+        for (const auto& current_assignment: log.assignments_) {
+            // Catch a Fact that is not in the FactDatabase, keeping its name
+            auto& new_record = Append();
+            auto fact_handle = fact_database.Handle(current_assignment.first);
+            if (!fact_handle.has_value()) {
+                new_record.unresolved_name_ = static_cast<std::uint32_t>(unresolved_names_.size());
+                unresolved_names_.push_back(current_assignment.first);
+                continue;
+            }
+            new_record.fact_ = fact_handle.value();
+
+            // Copy the raw session value, based on its type
+            const auto& logged_value = current_assignment.second;
+            switch (logged_value.type_) {
+                case utility::ExpertSystemTypes::kBool: {
+                    // Copy the raw value and its metadata
+                    const auto& raw_value = std::get<knowledge::facts::BoolValue>(logged_value.value_);
+                    new_record.value_ = raw_value.value_;
+                    new_record.confidence_ = raw_value.confidence_factor_.Get();
+                    new_record.timestamp_ = raw_value.timestamp_;
+                    break;
+                }
+                case utility::ExpertSystemTypes::kInt: {
+                    // Copy the raw value and its metadata
+                    const auto& raw_value = std::get<knowledge::facts::IntValue>(logged_value.value_);
+                    new_record.value_ = raw_value.value_;
+                    new_record.confidence_ = raw_value.confidence_factor_.Get();
+                    new_record.timestamp_ = raw_value.timestamp_;
+                    break;
+                }
+                case utility::ExpertSystemTypes::kFloat: {
+                    // Copy the raw value and its metadata
+                    const auto& raw_value = std::get<knowledge::facts::FloatValue>(logged_value.value_);
+                    new_record.value_ = raw_value.value_;
+                    new_record.confidence_ = raw_value.confidence_factor_.Get();
+                    new_record.timestamp_ = raw_value.timestamp_;
+                    break;
+                }
+                case utility::ExpertSystemTypes::kEnum: {
+                    // Copy the raw value's EnumId and its metadata, leaving the DynamicEnum with the Fact
+                    const auto& enum_value = std::get<knowledge::facts::EnumValue>(logged_value.value_);
+                    const auto& raw_value = enum_value.value_;
+                    auto enum_id = enum_value.enum_.Id(raw_value.value_);
+                    if (!enum_id.has_value()) {
+                        continue;
+                    }
+                    new_record.value_ = enum_id.value();
+                    new_record.confidence_ = raw_value.confidence_factor_.Get();
+                    new_record.timestamp_ = raw_value.timestamp_;
+                    break;
+                }
+                default: {
+                    // Leave the session value unknown
+                    continue;
+                }
+            }
+
+            // Store the type
+            new_record.type_ = logged_value.type_;
+        }
+    }
+
+    void TraceStore::Write(const std::vector<Log>& logs, const knowledge::facts::FactDatabase& fact_database) {
+        // Record each Log as an event of a new step
+        BeginStep();
+        for (const auto& current_log: logs) {
+            Record(current_log, fact_database);
+        }
+    }
+
+    std::size_t TraceStore::Size() const {
+        // Provide the amount of records in use
+        return size_;
+    }
+
+    std::size_t TraceStore::StepCount() const {
+        // Provide the amount of steps
+        return steps_.size();
+    }
+
+    std::size_t TraceStore::EventCount() const {
+        // Provide the amount of events
+        return events_.size();
+    }
+
+    const TraceRecord& TraceStore::At(std::size_t index) const {
+        // Find the record within its block
+        return blocks_[index / kBlockSize][index % kBlockSize];
+    }
+
+    std::optional<TraceStore::RuleIterator> TraceStore::Rule(knowledge::rules::RuleId source) const {
+        // Catch the events caused by a user
+        if (source == kUserSource) {
+            return std::nullopt;
+        }
+
+        // Provide the Rule currently stored under the RuleId, if it has not been removed
+        return rule_database_->Iterator(source);
+    }
+
+    std::vector<TraceStore::RuleIterator> TraceStore::FiredRules() const {
+        // Gather the Rule of each event, skipping the user
+        std::vector<RuleIterator> fired_rules;
+        for (const auto& current_event: events_) {
+            auto event_rule = Rule(current_event.source_);
+            if (event_rule.has_value()) {
+                fired_rules.push_back(event_rule.value());
+            }
+        }
+        return fired_rules;
+    }
+
+    std::vector<Log> TraceStore::Logs(std::size_t step, const knowledge::facts::FactDatabase& fact_database) const {
+        // Catch a step that does not exist
+        std::vector<Log> step_logs;
+        if (step >= steps_.size()) {
+            return step_logs;
+        }
+
+        // Rebuild a Log for each of the step's events
+        auto end_event = (step + 1 < steps_.size()) ? steps_[step + 1] : events_.size();
+        for (auto event_index = steps_[step]; event_index < end_event; ++event_index) {
+            // Restore the Rule that caused the event
+            Log& event_log = step_logs.emplace_back();
+            event_log.rule_ = Rule(events_[event_index].source_);
+            if (events_[event_index].source_ != kUserSource) {
+                event_log.rule_id_ = events_[event_index].source_;
+            }
+
+            // Restore each of the event's session values
+            auto end_record = (event_index + 1 < events_.size()) ? events_[event_index + 1].first_record_ : size_;
+            for (auto record_index = events_[event_index].first_record_; record_index < end_record; ++record_index) {
+                // Gather the Fact's name, skipping any Fact that has since been deleted
+                const auto& current_record = At(record_index);
+                std::optional<std::reference_wrapper<const std::string>> fact_name;
+                if (current_record.fact_ == knowledge::facts::kInvalidFactHandle) {
+                    fact_name = unresolved_names_[current_record.unresolved_name_];
+                } else {
+                    fact_name = fact_database.Name(current_record.fact_);
+                }
+                if (!fact_name.has_value()) {
+                    continue;
+                }
+
+                // Rebuild the session value, based on its type
+                knowledge::facts::VariantValue restored_value;
+                utility::Confidence confidence_factor(current_record.confidence_);
+                switch (current_record.type_) {
+                    case utility::ExpertSystemTypes::kBool: {
+                        // Restore the raw value and its metadata
+                        restored_value.value_ = knowledge::facts::BoolValue(std::get<bool>(current_record.value_),
+                                                                            confidence_factor,
+                                                                            current_record.timestamp_);
+                        restored_value.type_ = current_record.type_;
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kInt: {
+                        // Restore the raw value and its metadata
+                        restored_value.value_ = knowledge::facts::IntValue(std::get<int>(current_record.value_),
+                                                                           confidence_factor,
+                                                                           current_record.timestamp_);
+                        restored_value.type_ = current_record.type_;
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kFloat: {
+                        // Restore the raw value and its metadata
+                        restored_value.value_ = knowledge::facts::FloatValue(std::get<float>(current_record.value_),
+                                                                             confidence_factor,
+                                                                             current_record.timestamp_);
+                        restored_value.type_ = current_record.type_;
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kEnum: {
+                        // Restore the enum value's current position, if the Fact is still an enum Fact containing it
+                        auto found_fact = fact_database.Find(current_record.fact_);
+                        if (!found_fact.has_value()
+                            || (found_fact->get().type_ != utility::ExpertSystemTypes::kEnum)) {
+                            break;
+                        }
+                        const auto& fact_enum = std::get<knowledge::facts::EnumFact>(found_fact->get().fact_).enum_;
+                        auto position = fact_enum.Position(std::get<utility::EnumId>(current_record.value_));
+                        if (!position.has_value()) {
+                            break;
+                        }
+                        restored_value.value_ = knowledge::facts::EnumValue(
+                                fact_enum,
+                                knowledge::facts::IntValue(position.value(),
+                                                           confidence_factor,
+                                                           current_record.timestamp_));
+                        restored_value.type_ = current_record.type_;
+                        break;
+                    }
+                    default: {
+                        // Leave the session value unknown
+                        break;
+                    }
+                }
+
+                // Add the session value to the Log
+                event_log.assignments_.emplace(fact_name->get(), std::move(restored_value));
+            }
+        }
+
+        // Provide the rebuilt Logs
+        return step_logs;
+    }
+
+    std::size_t TraceStore::ReservedBytes() const {
+        // Add the record blocks to each of the indexes
+        auto reserved_bytes = blocks_.size() * kBlockSize * sizeof(TraceRecord);
+        reserved_bytes += events_.capacity() * sizeof(Event);
+        reserved_bytes += steps_.capacity() * sizeof(std::size_t);
+        for (const auto& current_name: unresolved_names_) {
+            reserved_bytes += sizeof(std::string) + current_name.capacity();
+        }
+        return reserved_bytes;
+    }
+
+    void TraceStore::Clear() {
+        // Discard the records and every index
+        blocks_.clear();
+        size_ = 0;
+        events_.clear();
+        steps_.clear();
+        unresolved_names_.clear();
+    }
+
+    TraceRecord& TraceStore::Append() {
+        // Start a new block once the last one is full
+        if (size_ == blocks_.size() * kBlockSize) {
+            blocks_.push_back(std::make_unique<TraceRecord[]>(kBlockSize));
+        }
+
+        // Fill the record with the current step and event, and an unknown session value
+        auto& new_record = blocks_[size_ / kBlockSize][size_ % kBlockSize];
+        new_record = TraceRecord{static_cast<std::uint32_t>(steps_.size() - 1),
+                                 events_.back().source_,
+                                 knowledge::facts::kInvalidFactHandle,
+                                 0,
+                                 utility::ExpertSystemTypes::kUnknown,
+                                 std::monostate(),
+                                 0.0f,
+                                 {}};
+        ++size_;
+        return new_record;
+    }
+
+} // namespace expert_system::engines::explanation
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "engines/explanation/Log.hpp"
+#include "engines/explanation/LogSink.hpp"
+#include "knowledge/facts/FactDatabase.hpp"
+#include "knowledge/facts/FactHandle.hpp"
+#include "knowledge/rules/Rule.hpp"
+#include "knowledge/rules/RuleDatabase.hpp"
+#include "knowledge/rules/RuleId.hpp"
+#include "utility/DynamicEnum.hpp"
+#include "utility/Types.hpp"
+
+namespace expert_system::engines::explanation {
+
+        /**
+         * @brief A single session value recorded by a TraceStore, with a fixed size.
+         * Enum session values are stored by their EnumId, and named through the Fact's own DynamicEnum.
+         */
+    struct TraceRecord {
+            /// The index of the step that the session value was recorded in.
+        std::uint32_t step_;
+
+            /// The RuleId of the Rule that caused the event, or TraceStore::kUserSource if it was caused by a user.
+        knowledge::rules::RuleId source_;
+
+            /// The Fact that was assigned, or kInvalidFactHandle if the Fact is not in the FactDatabase.
+        knowledge::facts::FactHandle fact_;
+
+            /// The index of the name of a Fact that is not in the FactDatabase, only used without a FactHandle.
+        std::uint32_t unresolved_name_;
+
+            /// The type of the session value, which is kUnknown if the Fact had no session value.
+        utility::ExpertSystemTypes type_;
+
+            /// The raw session value, enum Facts use the EnumId of the enum value.
+        std::variant<std::monostate, bool, int, float, utility::EnumId> value_;
+
+            /// The raw confidence factor of the session value.
+        float confidence_;
+
+            /// The time that the session value was constructed.
+        std::chrono::time_point<std::chrono::system_clock> timestamp_;
+    };
+
+        /**
+         * @brief An append-only store of the session values assigned during a consultation.
+         * Each step of the consultation contains events, and each event is caused by a Rule or by the user.
+         * The session values are recorded as fixed-size TraceRecords, in blocks that are never moved or copied,
+         * so that long consultations do not copy the Facts' names or DynamicEnums for every assignment.
+         * This is the in-memory LogSink, which keeps every event for presenting the consultation afterwards.
+         * Rules and enum values are referenced by RuleId and EnumId, so the Rules and Facts may be edited afterwards.
+         * @warning The RuleDatabase must outlive the TraceStore!
+         */
+    class TraceStore : public LogSink {
+    public:
+            /// The TraceRecord source for the events caused by a user.
+        static constexpr knowledge::rules::RuleId kUserSource = knowledge::rules::kInvalidRuleId;
+
+            /// The amount of TraceRecords in each block.
+        static constexpr std::size_t kBlockSize = 1024;
+
+            /**
+             * @brief Parameterized constructor, creates an empty TraceStore.
+             * @param [in] rule_database The RuleDatabase that issues the RuleIds of the Rules causing events.
+             */
+        explicit TraceStore(knowledge::rules::RuleDatabase& rule_database);
+
+            /// Starts a new step, subsequent events are added to it.
+        void BeginStep() override;
+
+            /**
+             * @brief Starts a new event in the current step, subsequent session values are added to it.
+             * @param [in] rule The iterator to the Rule that caused the event, or std::nullopt if it was caused by a user.
+             * @note A step is started if there is none.
+             */
+        void BeginEvent(std::optional<RuleIterator> rule) override;
+
+            /**
+             * @brief Records the current session value of a Fact in the current event.
+             * @param [in] fact_name The name of the Fact.
+             * @param [in] fact_database The FactDatabase to gather the session value from.
+             * @note Facts without a session value, or that are not in the FactDatabase, are recorded as unknown.
+             * @warning An event must have been started!
+             */
+        void Record(const std::string& fact_name, const knowledge::facts::FactDatabase& fact_database) override;
+
+            /**
+             * @brief Records a Log as a new event in the current step.
+             * @param [in] log The Log to record.
+             * @param [in] fact_database The FactDatabase that the Log's session values were gathered from.
+             * @note Enum session values are recorded by their EnumId, without copying their DynamicEnum.
+             */
+        void Record(const Log& log, const knowledge::facts::FactDatabase& fact_database);
+
+            /**
+             * @brief Records a set of Logs as a new step.
+             * @param [in] logs The Logs to record, one event for each.
+             * @param [in] fact_database The FactDatabase that the Logs' session values were gathered from.
+             * @note The session values are copied from the Logs, rather than gathered from the FactDatabase again.
+             */
+        void Write(const std::vector<Log>& logs, const knowledge::facts::FactDatabase& fact_database) override;
+
+            /**
+             * @brief Gathers the amount of recorded session values.
+             * @return The amount of TraceRecords.
+             */
+        [[nodiscard]] std::size_t Size() const;
+
+            /**
+             * @brief Gathers the amount of steps.
+             * @return The amount of steps, including any without events.
+             */
+        [[nodiscard]] std::size_t StepCount() const;
+
+            /**
+             * @brief Gathers the amount of events.
+             * @return The amount of events, including any without session values.
+             */
+        [[nodiscard]] std::size_t EventCount() const;
+
+            /**
+             * @brief Provides read access to a recorded session value.
+             * @param [in] index The index of the TraceRecord, in the order it was recorded.
+             * @return A const reference to the TraceRecord, which stays valid as more are recorded.
+             * @warning The index must be less than Size()!
+             */
+        [[nodiscard]] const TraceRecord& At(std::size_t index) const;
+
+            /**
+             * @brief Gathers the Rule that caused the events with a specific source.
+             * @param [in] source The source of a TraceRecord.
+             * @return The iterator to the Rule, or std::nullopt if the events were caused by a user,
+             * or the Rule has since been removed.
+             */
+        [[nodiscard]] std::optional<RuleIterator> Rule(knowledge::rules::RuleId source) const;
+
+            /**
+             * @brief Lists the Rules that caused each event, in the order they were recorded.
+             * @return A list of the iterators to the Rules, skipping the events caused by a user or a removed Rule.
+             */
+        [[nodiscard]] std::vector<RuleIterator> FiredRules() const;
+
+            /**
+             * @brief Rebuilds the Logs of a step, for presenting the consultation.
+             * @param [in] step The index of the step.
+             * @param [in] fact_database The FactDatabase that the session values were recorded from.
+             * @return One Log for each of the step's events, or an empty list if the step does not exist.
+             * @note Enum session values are named through the Fact's current DynamicEnum, skipping removed enum values.
+             */
+        [[nodiscard]] std::vector<Log> Logs(std::size_t step, const knowledge::facts::FactDatabase& fact_database) const;
+
+            /**
+             * @brief Gathers the amount of memory held by the TraceStore's records and indexes.
+             * @return The amount of bytes reserved.
+             */
+        [[nodiscard]] std::size_t ReservedBytes() const;
+
+            /// Discards every step, event and TraceRecord.
+        void Clear();
+
+    private:
+            /// The start of an event.
+        struct Event {
+                /// The source of the event's TraceRecords.
+            knowledge::rules::RuleId source_;
+
+                /// The index of the event's first TraceRecord.
+            std::size_t first_record_;
+        };
+
+            /**
+             * @brief Reserves the next TraceRecord, starting a new block if the last one is full.
+             * @return A reference to the new TraceRecord, which is filled with the current step and event.
+             */
+        TraceRecord& Append();
+
+            /// The blocks of TraceRecords, each holding kBlockSize of them.
+        std::vector<std::unique_ptr<TraceRecord[]>> blocks_;
+
+            /// The amount of TraceRecords in use.
+        std::size_t size_ = 0;
+
+            /// The events, in the order they were started.
+        std::vector<Event> events_;
+
+            /// The index of the first event of each step.
+        std::vector<std::size_t> steps_;
+
+            /// The RuleDatabase that issues the RuleIds of the Rules causing events.
+        knowledge::rules::RuleDatabase* rule_database_;
+
+            /// The names of the recorded Facts that were not in the FactDatabase.
+        std::vector<std::string> unresolved_names_;
+    };
+
+} // namespace expert_system::engines::explanation
@@ -0,0 +1,192 @@
+#include "Agenda.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <variant>
+
+namespace expert_system::engines::inference {
+
+    namespace {
+
+            /**
+             * @brief Gathers the highest confidence factor of a Rule's Assignments.
+             * @param [in] rule The target Rule.
+             * @return The highest confidence factor, or 0 if the Rule has no valid Assignments.
+             */
+        float HighestConfidence(const knowledge::rules::Rule& rule) {
+            // Iterate through the Rule's Assignments
+            float highest_confidence = 0.0f;
+            for (const auto& current_assignment: rule.response_.assignments_) {
+                // Gather the Assignment's confidence factor, depending on its type
+                float assignment_confidence = 0.0f;
+                switch (current_assignment.type_) {
+                    case utility::ExpertSystemTypes::kBool: {
+                        assignment_confidence = std::get<knowledge::rules::BoolAssignment>(
+                                current_assignment.assignment_).confidence_factor_.Get();
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kInt: {
+                        assignment_confidence = std::get<knowledge::rules::IntAssignment>(
+                                current_assignment.assignment_).confidence_factor_.Get();
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kFloat: {
+                        assignment_confidence = std::get<knowledge::rules::FloatAssignment>(
+                                current_assignment.assignment_).confidence_factor_.Get();
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kEnum: {
+                        assignment_confidence = std::get<knowledge::rules::EnumAssignment>(
+                                current_assignment.assignment_).confidence_factor_.Get();
+                        break;
+                    }
+                    default: {
+                        // Skip the invalid Assignment
+                        break;
+                    }
+                }
+
+                // Keep track of the highest confidence factor
+                highest_confidence = std::max(highest_confidence, assignment_confidence);
+            }
+
+            // Return the highest confidence factor
+            return highest_confidence;
+        }
+
+    } // namespace
+
+    Agenda::Agenda(ConflictStrategy strategy)
+        : activations_(Ordering{strategy == ConflictStrategy::kUnknown ? ConflictStrategy::kSalience : strategy}),
+          next_sequence_(0) {}
+
+    bool Agenda::Insert(std::map<std::string, knowledge::rules::Rule>::iterator rule) {
+        // Catch if the Rule already has an activation
+        if (activation_lookup_.find(rule->first) != activation_lookup_.end()) {
+            // Stop and indicate failure
+            return false;
+        }
+
+        // Gather the keys for the activation
+        Activation new_activation{rule,
+                                  rule->second.priority_,
+                                  next_sequence_++,
+                                  rule->second.trigger_.condition_chain_.size() + 1,
+                                  HighestConfidence(rule->second)};
+
+        // Store the activation, and index it by the Rule's name
+        auto insert_result = activations_.insert(new_activation);
+        activation_lookup_.emplace(rule->first, insert_result.first);
+        return true;
+    }
+
+    bool Agenda::Remove(const std::string& name) {
+        // Catch if the Rule has no activation
+        auto search_result = activation_lookup_.find(name);
+        if (search_result == activation_lookup_.end()) {
+            // Stop and indicate failure
+            return false;
+        }
+
+        // Delete the activation and its index
+        activations_.erase(search_result->second);
+        activation_lookup_.erase(search_result);
+        return true;
+    }
+
+    bool Agenda::Contains(const std::string& name) const {
+        // Check the index for the Rule's name
+        return activation_lookup_.find(name) != activation_lookup_.end();
+    }
+
+    std::optional<std::map<std::string, knowledge::rules::Rule>::iterator> Agenda::Pop() {
+        // Catch an empty Agenda
+        if (activations_.empty()) {
+            // Stop and indicate failure
+            return std::nullopt;
+        }
+
+        // Remove the first activation and provide its Rule
+        auto first_rule = activations_.begin()->rule_;
+        activation_lookup_.erase(first_rule->first);
+        activations_.erase(activations_.begin());
+        return first_rule;
+    }
+
+    bool Agenda::Empty() const {
+        // Check the amount of activations
+        return activations_.empty();
+    }
+
+    std::size_t Agenda::Size() const {
+        // Provide the amount of activations
+        return activations_.size();
+    }
+
+    void Agenda::Clear() {
+        // Delete every activation and its index
+        activations_.clear();
+        activation_lookup_.clear();
+    }
+
+    ConflictStrategy Agenda::Strategy() const {
+        // Provide the ordering's strategy
+        return activations_.key_comp().strategy_;
+    }
+
+    void Agenda::SetStrategy(ConflictStrategy strategy) {
+        // Treat kUnknown as kSalience, as in the constructor
+        if (strategy == ConflictStrategy::kUnknown) {
+            strategy = ConflictStrategy::kSalience;
+        }
+
+        // Catch if the strategy is unchanged
+        if (strategy == Strategy()) {
+            return;
+        }
+
+        // Reorder the existing activations with the new strategy
+        std::set<Activation, Ordering> reordered_activations(Ordering{strategy});
+        activation_lookup_.clear();
+        for (const auto& current_activation: activations_) {
+            auto insert_result = reordered_activations.insert(current_activation);
+            activation_lookup_.emplace(current_activation.rule_->first, insert_result.first);
+        }
+        activations_ = std::move(reordered_activations);
+    }
+
+    bool Agenda::Ordering::operator()(const Activation& lhs, const Activation& rhs) const {
+        // Order by the strategy's key first, higher keys are run first
+        switch (strategy_) {
+            case ConflictStrategy::kRecency: {
+                if (lhs.sequence_ != rhs.sequence_) {
+                    return lhs.sequence_ > rhs.sequence_;
+                }
+                break;
+            }
+            case ConflictStrategy::kSpecificity: {
+                if (lhs.specificity_ != rhs.specificity_) {
+                    return lhs.specificity_ > rhs.specificity_;
+                }
+                break;
+            }
+            case ConflictStrategy::kConfidence: {
+                if (lhs.confidence_ != rhs.confidence_) {
+                    return lhs.confidence_ > rhs.confidence_;
+                }
+                break;
+            }
+            default: {
+                // Salience is already the first tie-breaker
+                break;
+            }
+        }
+
+        // Break ties by the Rules' priorities, and then by their unique names
+        if (lhs.priority_ != rhs.priority_) {
+            return lhs.priority_ > rhs.priority_;
+        }
+        return lhs.rule_->first < rhs.rule_->first;
+    }
+
+} // namespace expert_system::engines::inference
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+#include "nlohmann/json.hpp"
+
+#include "knowledge/rules/Rule.hpp"
+
+namespace expert_system::engines::inference {
+
+        /// The symbolic representations of the Agenda's conflict resolution strategies.
+    enum class ConflictStrategy {
+        kUnknown,
+        kSalience,
+        kRecency,
+        kSpecificity,
+        kConfidence
+    };
+
+        /// JSON serialization for the ConflictStrategy enum.
+    NLOHMANN_JSON_SERIALIZE_ENUM(ConflictStrategy,
+                                 {{ConflictStrategy::kUnknown, nullptr},
+                                  {ConflictStrategy::kSalience, "Salience"},
+                                  {ConflictStrategy::kRecency, "Recency"},
+                                  {ConflictStrategy::kSpecificity, "Specificity"},
+                                  {ConflictStrategy::kConfidence, "Confidence"}})
+
+        /**
+         * @brief An ordered set of the triggered Rules that are waiting to be run (activations).
+         * The activations are ordered by a ConflictStrategy, and then by each Rule's priority and name.
+         * @note Activations are stored by iterator, so the Rule Database must outlive the Agenda.
+         */
+    class Agenda {
+    public:
+            /**
+             * @brief Parameterized constructor.
+             * @param [in] strategy The ConflictStrategy used to order the activations.
+             * @note kUnknown is treated as kSalience.
+             */
+        explicit Agenda(ConflictStrategy strategy = ConflictStrategy::kSalience);
+
+            /**
+             * @brief Adds an activation for a Rule.
+             * @param [in] rule The iterator to the triggered Rule.
+             * @return True if the activation was added, False if the Rule already has an activation.
+             */
+        bool Insert(std::map<std::string, knowledge::rules::Rule>::iterator rule);
+
+            /**
+             * @brief Removes the activation for a Rule.
+             * @param [in] name The name of the Rule.
+             * @return True if an activation was removed, False if the Rule had no activation.
+             */
+        bool Remove(const std::string& name);
+
+            /**
+             * @brief Checks if a Rule currently has an activation.
+             * @param [in] name The name of the Rule.
+             * @return True if the Rule has an activation, False otherwise.
+             */
+        [[nodiscard]] bool Contains(const std::string& name) const;
+
+            /**
+             * @brief Removes and provides the first activation, as ordered by the ConflictStrategy.
+             * @return The iterator to the activation's Rule, or std::nullopt if the Agenda is empty.
+             */
+        std::optional<std::map<std::string, knowledge::rules::Rule>::iterator> Pop();
+
+            /**
+             * @brief Checks if the Agenda has no activations.
+             * @return True if there are no activations, False otherwise.
+             */
+        [[nodiscard]] bool Empty() const;
+
+            /**
+             * @brief Gathers the amount of activations.
+             * @return The amount of activations.
+             */
+        [[nodiscard]] std::size_t Size() const;
+
+            /// Removes every activation.
+        void Clear();
+
+            /**
+             * @brief Gathers the ConflictStrategy used to order the activations.
+             * @return The ConflictStrategy.
+             */
+        [[nodiscard]] ConflictStrategy Strategy() const;
+
+            /**
+             * @brief Changes the ConflictStrategy, reordering the existing activations.
+             * @param [in] strategy The ConflictStrategy used to order the activations.
+             */
+        void SetStrategy(ConflictStrategy strategy);
+
+    private:
+            /// A triggered Rule, with the keys used by every ConflictStrategy.
+        struct Activation {
+                /// The triggered Rule.
+            std::map<std::string, knowledge::rules::Rule>::iterator rule_;
+
+                /// The Rule's priority, when it was activated.
+            int priority_;
+
+                /// The order that the activation was added in, more recent activations are higher.
+            std::uint64_t sequence_;
+
+                /// The amount of Conditions in the Rule's Antecedent.
+            std::size_t specificity_;
+
+                /// The highest confidence factor of the Rule's Assignments.
+            float confidence_;
+        };
+
+            /// Orders the activations by the Agenda's ConflictStrategy.
+        struct Ordering {
+                /**
+                 * @brief Checks if one activation should be run before another.
+                 * @param [in] lhs The first activation.
+                 * @param [in] rhs The second activation.
+                 * @return True if lhs should be run first, False otherwise.
+                 */
+            bool operator()(const Activation& lhs, const Activation& rhs) const;
+
+                /// The ConflictStrategy to order by.
+            ConflictStrategy strategy_;
+        };
+
+            /// The activations, in the order that they will be run.
+        std::set<Activation, Ordering> activations_;
+
+            /// Maps each activated Rule's name to its activation.
+        std::unordered_map<std::string, std::set<Activation, Ordering>::iterator> activation_lookup_;
+
+            /// The sequence number for the next activation.
+        std::uint64_t next_sequence_;
+    };
+
+} // namespace expert_system::engines::inference
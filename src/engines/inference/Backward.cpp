@@ -0,0 +1,177 @@
+#include "Backward.hpp"
+
+#include <map>
+
+#include "knowledge/facts/Values.hpp"
+#include "utility/Counters.hpp"
+
+namespace expert_system::engines::inference::backward {
+
+    namespace {
+
+            /// The working state of a single goal resolution.
+        struct GoalSearch {
+                /// The database of Facts to operate on.
+            knowledge::facts::FactDatabase& fact_database_;
+
+                /// The database of Rules to operate on.
+            knowledge::rules::RuleDatabase& rule_database_;
+
+                /// The results being collected.
+            GoalResolution& resolution_;
+
+                /// Memoized outcomes of the sub-goals that have already been explored.
+            std::map<std::string, GoalOutcome> explored_;
+
+                /// The sub-goals currently being explored, used to detect cycles.
+            std::set<std::string> in_progress_;
+        };
+
+            /**
+             * @brief Runs a Rule's Consequent and logs the outcome.
+             * @param [in] rule The iterator to the Rule to action.
+             * @param [in] search The working state of the goal resolution.
+             */
+        void Fire(std::map<std::string, knowledge::rules::Rule>::iterator rule, GoalSearch& search) {
+            // Attempt the Rule's assignment and track the results
+            auto assignment_outcomes = rule->second.response_.Assign(search.fact_database_);
+
+            // Create a Log for this Rule's attempted assignment
+            explanation::Log current_fact_log;
+            current_fact_log.rule_ = rule;
+            for (auto& current_outcome: assignment_outcomes) {
+                // Gather the assignment's Fact and add the assigned data to the Log
+                current_fact_log.assignments_.emplace(current_outcome.first,
+                                                      search.fact_database_.GetVariantValue(current_outcome.first));
+
+                // The Fact's session value may have changed, so forget what was explored about it
+                search.explored_.erase(current_outcome.first);
+            }
+
+            // Update the Rule to keep track of it already being run, and store the log
+            rule->second.successful_response_ = true;
+            search.resolution_.logs_.push_back(current_fact_log);
+        }
+
+            /**
+             * @brief Recursively attempts to resolve the session value of a Fact.
+             * @param [in] fact_name The name of the target Fact.
+             * @param [in] is_goal Whether this is the top-level goal, which is never requested from the user.
+             * @param [in] search The working state of the goal resolution.
+             * @return The outcome of the attempt.
+             */
+        GoalOutcome Resolve(const std::string& fact_name, bool is_goal, GoalSearch& search) {
+            // Catch if the Fact already has a session value
+            if (search.fact_database_.Known(fact_name)) {
+                return GoalOutcome::kKnown;
+            }
+
+            // Catch if the Fact has already been explored
+            auto explored_result = search.explored_.find(fact_name);
+            if (explored_result != search.explored_.end()) {
+                return explored_result->second;
+            }
+
+            // Catch a cycle, which cannot resolve the Fact along this path
+            if (search.in_progress_.count(fact_name) != 0) {
+                return GoalOutcome::kUnresolvable;
+            }
+            search.in_progress_.insert(fact_name);
+
+            // Iterate through the Rules that could assign the Fact a session value
+            auto outcome = GoalOutcome::kUnresolvable;
+            bool has_pending_rule = false;
+            for (const auto& current_rule_name: search.rule_database_.ListFactWriters(fact_name)) {
+                // Skip the Rules that have already been run
+                auto current_rule = search.rule_database_.managed_rules_.find(current_rule_name);
+                if ((current_rule == search.rule_database_.managed_rules_.end())
+                    || current_rule->second.successful_response_) {
+                    continue;
+                }
+
+                // Attempt to resolve each of the sub-goals that the Rule's Antecedent requires
+                bool requires_input = false;
+                for (const auto& current_fact_name: current_rule->second.TriggerFacts()) {
+                    auto sub_outcome = Resolve(current_fact_name, false, search);
+                    if (sub_outcome == GoalOutcome::kRequiresInput) {
+                        requires_input = true;
+                    }
+                }
+
+                // Test the Rule now that its sub-goals have been explored
+                utility::Count(utility::Counter::kRulesTested);
+                auto test_result = current_rule->second.trigger_.Test(search.fact_database_);
+                if (test_result == knowledge::rules::TestOutcome::kComparisonSuccess) {
+                    // Run the Rule, which may resolve the Fact
+                    Fire(current_rule, search);
+                } else if (test_result == knowledge::rules::TestOutcome::kComparisonFailure) {
+                    // The Rule can never fire, so flag it as run without actioning it
+                    current_rule->second.successful_response_ = true;
+                } else if ((test_result == knowledge::rules::TestOutcome::kUnknownFactValue) && requires_input) {
+                    // The Rule may still fire once the user provides more session values
+                    has_pending_rule = true;
+                }
+
+                // Stop once the Fact has been resolved
+                if (search.fact_database_.Known(fact_name)) {
+                    outcome = GoalOutcome::kKnown;
+                    break;
+                }
+            }
+
+            // Identify if the Fact could still be resolved
+            if ((outcome != GoalOutcome::kKnown) && has_pending_rule) {
+                outcome = GoalOutcome::kRequiresInput;
+            } else if ((outcome != GoalOutcome::kKnown) && !is_goal
+                       && search.fact_database_.Handle(fact_name).has_value()) {
+                // No Rule can resolve the sub-goal, so request it from the user instead
+                search.resolution_.requests_.insert(fact_name);
+                outcome = GoalOutcome::kRequiresInput;
+            }
+
+            // Memoize the outcome and finish exploring the Fact
+            search.in_progress_.erase(fact_name);
+            search.explored_[fact_name] = outcome;
+            return outcome;
+        }
+
+    } // namespace
+
+    GoalResolution ResolveGoal(
+            const std::string& goal_fact,
+            knowledge::facts::FactDatabase& fact_database,
+            knowledge::rules::RuleDatabase& rule_database) {
+        GoalResolution resolution;
+        while (true) {
+            // Begin a new search from the goal
+            resolution.requests_.clear();
+            GoalSearch search{fact_database, rule_database, resolution, {}, {}};
+            resolution.outcome_ = Resolve(goal_fact, true, search);
+
+            // Requests are only meaningful if the goal is still waiting on the user
+            if (resolution.outcome_ != GoalOutcome::kRequiresInput) {
+                resolution.requests_.clear();
+                break;
+            }
+
+            // Discard the requested Facts that were resolved later in the search
+            for (auto current_request = resolution.requests_.begin();
+                 current_request != resolution.requests_.end();) {
+                if (fact_database.Known(*current_request)) {
+                    current_request = resolution.requests_.erase(current_request);
+                } else {
+                    ++current_request;
+                }
+            }
+
+            // Search again if the resolved Facts have made progress without the user
+            if (!resolution.requests_.empty()) {
+                break;
+            }
+        }
+
+        // Return the results of the attempt
+        return resolution;
+    }
+
+} // namespace expert_system::engines::inference::backward
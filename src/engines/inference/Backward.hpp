@@ -0,0 +1,53 @@
+#pragma once
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "knowledge/facts/FactDatabase.hpp"
+#include "knowledge/rules/RuleDatabase.hpp"
+#include "engines/explanation/Log.hpp"
+
+namespace expert_system::engines::inference::backward {
+
+        /// Enum for the outcome of an attempt to resolve a goal Fact.
+    enum class GoalOutcome {
+        kKnown,
+        kRequiresInput,
+        kUnresolvable
+    };
+
+        /**
+         * @brief The results of a single attempt to resolve a goal Fact.
+         * Collects the Rules that were run and the session values still needed from the user.
+         */
+    struct GoalResolution {
+            /// The outcome of the attempt.
+        GoalOutcome outcome_ = GoalOutcome::kUnresolvable;
+
+            /// A set of logs, one for each Rule that had successfully run its Assignment action.
+        std::vector<explanation::Log> logs_;
+
+            /**
+             * @brief The names of the Facts that require a session value from the user.
+             * @note Only populated when the outcome is kRequiresInput.
+             */
+        std::set<std::string> requests_;
+    };
+
+        /**
+         * @brief Attempts to resolve the session value of a goal Fact by chaining backwards through the Rules.
+         * Only the Rules with a Consequent that writes the goal, or one of its sub-goals, are tested.
+         * @param [in] goal_fact The name of the goal Fact.
+         * @param [in] fact_database The database of Facts to operate on.
+         * @param [in] rule_database The database of Rules to operate on.
+         * @return The outcome, logs and requests of the attempt.
+         * @note Call again after the requested session values have been provided to continue the consultation.
+         * @note Each Rule is only run once, and Rules that fail their test are flagged as run without being actioned.
+         */
+    GoalResolution ResolveGoal(
+            const std::string& goal_fact,
+            knowledge::facts::FactDatabase& fact_database,
+            knowledge::rules::RuleDatabase& rule_database);
+
+} // namespace expert_system::engines::inference::backward
@@ -0,0 +1,80 @@
+#include "Batch.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+#include "engines/inference/Forward.hpp"
+#include "engines/inference/MatchNetwork.hpp"
+#include "utility/SymbolsJSON.hpp"
+#include "utility/ThreadPool.hpp"
+
+namespace expert_system::engines::inference::batch {
+
+    std::vector<CaseResult> RunCases(
+            const knowledge::facts::FactDatabase& fact_database,
+            const knowledge::rules::RuleDatabase& rule_database,
+            const std::vector<nlohmann::json>& cases,
+            std::size_t thread_count,
+            std::optional<ConflictStrategy> strategy) {
+        // Allocate a result for every case up front, so each worker can write to its own
+        std::vector<CaseResult> case_results(cases.size());
+        if (cases.empty()) {
+            return case_results;
+        }
+
+        // Never start more workers than there are cases
+        utility::ThreadPool worker_pool(thread_count);
+        auto worker_count = std::min(worker_pool.Size(), cases.size());
+
+        // Each worker claims the next unprocessed case until none remain
+        std::atomic<std::size_t> next_case(0);
+        for (std::size_t worker_index = 0; worker_index < worker_count; ++worker_index) {
+            worker_pool.Submit([&]() {
+                // Fork the Facts, sharing them until a session value is assigned, then copy the Rules and compile them once
+                auto worker_facts = fact_database.Fork();
+                auto worker_rules = rule_database;
+                MatchNetwork worker_network(worker_rules);
+                Agenda worker_agenda(strategy.value_or(ConflictStrategy::kSalience));
+
+                // Process cases until there are none left
+                for (auto case_index = next_case++; case_index < cases.size(); case_index = next_case++) {
+                    // Discard the previous case's session state
+                    worker_facts.Reset();
+                    worker_rules.ResetRules();
+
+                    // Assign the case's initial session values and run the consultation
+                    auto& case_result = case_results[case_index];
+                    case_result.rejected_facts_ = worker_facts.ImportValues(cases[case_index]);
+                    auto trace = strategy.has_value()
+                            ? forward::RunToCompletion(worker_facts, worker_rules, worker_network, worker_agenda)
+                            : forward::RunToCompletion(worker_facts, worker_rules, worker_network);
+
+                    // Record the Rules that were run, by name
+                    case_result.cycles_ = trace.StepCount();
+                    for (const auto& current_rule: trace.FiredRules()) {
+                        case_result.fired_rules_.push_back(current_rule->first);
+                    }
+
+                    // Copy the final session values
+                    for (auto& current_fact_name: worker_facts.List(knowledge::facts::FactFilter::kHasValue)) {
+                        case_result.conclusions_.emplace(current_fact_name,
+                                                         worker_facts.GetVariantValue(current_fact_name));
+                    }
+                }
+            });
+        }
+
+        // Wait for all of the cases to be processed
+        worker_pool.Wait();
+        return case_results;
+    }
+
+    void to_json(nlohmann::json& json_sys, const CaseResult& target) {
+        // Export each of the members
+        json_sys[utility::JSON_ID_CONCLUSIONS] = target.conclusions_;
+        json_sys[utility::JSON_ID_FIRED_RULES] = target.fired_rules_;
+        json_sys[utility::JSON_ID_CYCLES] = target.cycles_;
+        json_sys[utility::JSON_ID_REJECTED_FACTS] = target.rejected_facts_;
+    }
+
+} // namespace expert_system::engines::inference::batch
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "engines/inference/Agenda.hpp"
+#include "knowledge/facts/FactDatabase.hpp"
+#include "knowledge/facts/Values.hpp"
+#include "knowledge/rules/RuleDatabase.hpp"
+
+namespace expert_system::engines::inference::batch {
+
+        /**
+         * @brief The outcome of a single case's forward chaining consultation.
+         * Only stores names and copied Values, so it stays valid after the consultation's databases are gone.
+         */
+    struct CaseResult {
+            /// Maps the name of each Fact with a session value at the end of the consultation to a copy of that Value.
+        std::map<std::string, knowledge::facts::VariantValue> conclusions_;
+
+            /// The names of the Rules that were run, in the order they were run.
+        std::vector<std::string> fired_rules_;
+
+            /// The amount of rounds of triggered Rules that were run.
+        std::size_t cycles_ = 0;
+
+            /// The names of the Facts that could not be assigned their initial session value.
+        std::set<std::string> rejected_facts_;
+    };
+
+        /**
+         * @brief Runs a forward chaining consultation for each of a set of independent cases, in parallel.
+         * Each worker thread operates on its own copy of the databases, resetting the session state between cases.
+         * @param [in] fact_database The database of Facts, whose session values are ignored.
+         * @param [in] rule_database The database of Rules, whose run flags are ignored.
+         * @param [in] cases The initial session values for each case, see FactDatabase::ImportValues().
+         * @param [in] thread_count The amount of worker threads, or 0 for one per hardware thread.
+         * @param [in] strategy The ConflictStrategy to run the Rules one at a time with, or std::nullopt to run them in rounds.
+         * @return The result of each case, in the same order as the provided cases.
+         * @note The provided databases are only read, so they may not be edited until this returns.
+         */
+    std::vector<CaseResult> RunCases(
+            const knowledge::facts::FactDatabase& fact_database,
+            const knowledge::rules::RuleDatabase& rule_database,
+            const std::vector<nlohmann::json>& cases,
+            std::size_t thread_count = 0,
+            std::optional<ConflictStrategy> strategy = std::nullopt);
+
+        /**
+         * @brief CaseResult serialization to JSON format.
+         * @param [in,out] json_sys A reference to a JSON object.
+         * @param [in] target A reference to the CaseResult to export.
+         */
+    void to_json(nlohmann::json& json_sys, const CaseResult& target);
+
+} // namespace expert_system::engines::inference::batch
@@ -0,0 +1,242 @@
+#include "Bytecode.hpp"
+
+#include <optional>
+#include <variant>
+
+namespace expert_system::engines::inference {
+
+    namespace {
+
+            /**
+             * @brief Selects the test operation for a Condition.
+             * @param [in] first The operation for the type's kEqualTo comparison.
+             * @param [in] condition The Condition's comparison.
+             * @return The fused operation, or kInvalidCondition if the comparison is invalid.
+             */
+        OpCode Fuse(OpCode first, knowledge::rules::ConditionType condition) {
+            // The type's operations are ordered kEqualTo, kLessThan, then kGreaterThan
+            switch (condition) {
+                case knowledge::rules::ConditionType::kEqualTo:
+                    return first;
+                case knowledge::rules::ConditionType::kLessThan:
+                    return static_cast<OpCode>(static_cast<std::uint8_t>(first) + 1);
+                case knowledge::rules::ConditionType::kGreaterThan:
+                    return static_cast<OpCode>(static_cast<std::uint8_t>(first) + 2);
+                default:
+                    return OpCode::kInvalidCondition;
+            }
+        }
+
+            /**
+             * @brief Compares a Fact's session value against a Condition's target, as Condition::Test() does.
+             * @param [in] fact_value The Fact's session value.
+             * @param [in] target The Condition's target.
+             * @param [in] instruction The instruction being performed.
+             * @param [in] check_confidence A flag to indicate if the session value's confidence factor must be checked.
+             * @param [out] comparison The inverted result of the comparison, only valid on success.
+             * @return kComparisonSuccess if the comparison was performed, or the error outcome otherwise.
+             */
+        template<class T, class U>
+        knowledge::rules::TestOutcome Compare(const std::optional<knowledge::facts::Value<T>>& fact_value,
+                                              const U& target, const Instruction& instruction,
+                                              bool check_confidence, bool& comparison) {
+            // Catch a Fact without a session value
+            if (!fact_value.has_value()) {
+                return knowledge::rules::TestOutcome::kUnknownFactValue;
+            }
+
+            // Catch if the Fact's Value does not have a sufficient confidence factor
+            if (check_confidence && (fact_value->confidence_factor_.Get() < instruction.confidence_factor_)) {
+                return knowledge::rules::TestOutcome::kInsufficientConfidence;
+            }
+
+            // Perform the comparison, the type's operations are ordered kEqualTo, kLessThan, then kGreaterThan
+            bool raw_comparison = false;
+            switch ((static_cast<std::uint8_t>(instruction.op_code_)
+                     - static_cast<std::uint8_t>(OpCode::kBoolEqualTo)) % 3) {
+                case 0:
+                    raw_comparison = (fact_value->value_ == target);
+                    break;
+                case 1:
+                    raw_comparison = (target < fact_value->value_);
+                    break;
+                default:
+                    raw_comparison = (fact_value->value_ < target);
+                    break;
+            }
+
+            // Apply the inversion without branching
+            comparison = (raw_comparison != instruction.invert_);
+            return knowledge::rules::TestOutcome::kComparisonSuccess;
+        }
+
+    } // namespace
+
+    std::size_t BytecodeProgram::Compile(knowledge::rules::VariantCondition& condition) {
+        // Append the Condition, its instruction's index is the entry point
+        Append(condition);
+        return instructions_.size() - 1;
+    }
+
+    knowledge::rules::TestOutcome BytecodeProgram::Run(std::size_t entry, knowledge::facts::FactDatabase& source) {
+        // Perform the instruction's comparison
+        bool comparison = false;
+        auto outcome = Execute(instructions_[entry], source, comparison);
+
+        // Catch an error output
+        if (outcome != knowledge::rules::TestOutcome::kComparisonSuccess) {
+            return outcome;
+        }
+
+        // Return the comparison's outcome
+        return comparison ? knowledge::rules::TestOutcome::kComparisonSuccess
+                          : knowledge::rules::TestOutcome::kComparisonFailure;
+    }
+
+    std::size_t BytecodeProgram::Size() const {
+        // Provide the amount of instructions
+        return instructions_.size();
+    }
+
+    void BytecodeProgram::Clear() {
+        // Discard all of the compiled data
+        instructions_.clear();
+        strings_.clear();
+        string_indices_.clear();
+    }
+
+    void BytecodeProgram::Append(knowledge::rules::VariantCondition& condition) {
+        // Start with an instruction that reproduces VariantCondition::Test()'s failure
+        Instruction new_instruction{};
+        new_instruction.op_code_ = OpCode::kUnknown;
+
+        // Split logic depending on the Condition's type
+        switch (condition.type_) {
+            case utility::ExpertSystemTypes::kBool: {
+                // Gather the raw Condition and copy its contents
+                auto& raw_condition = std::get<knowledge::rules::BoolCondition>(condition.condition_);
+                new_instruction.op_code_ = Fuse(OpCode::kBoolEqualTo, raw_condition.condition_);
+                new_instruction.invert_ = raw_condition.invert_;
+                new_instruction.confidence_factor_ = raw_condition.confidence_factor_.Get();
+                new_instruction.fact_ = Intern(raw_condition.fact_);
+                new_instruction.target_.bool_ = raw_condition.target_;
+                break;
+            }
+            case utility::ExpertSystemTypes::kInt: {
+                // Gather the raw Condition and copy its contents
+                auto& raw_condition = std::get<knowledge::rules::IntCondition>(condition.condition_);
+                new_instruction.op_code_ = Fuse(OpCode::kIntEqualTo, raw_condition.condition_);
+                new_instruction.invert_ = raw_condition.invert_;
+                new_instruction.confidence_factor_ = raw_condition.confidence_factor_.Get();
+                new_instruction.fact_ = Intern(raw_condition.fact_);
+                new_instruction.target_.int_ = raw_condition.target_;
+                break;
+            }
+            case utility::ExpertSystemTypes::kFloat: {
+                // Gather the raw Condition and copy its contents
+                auto& raw_condition = std::get<knowledge::rules::FloatCondition>(condition.condition_);
+                new_instruction.op_code_ = Fuse(OpCode::kFloatEqualTo, raw_condition.condition_);
+                new_instruction.invert_ = raw_condition.invert_;
+                new_instruction.confidence_factor_ = raw_condition.confidence_factor_.Get();
+                new_instruction.fact_ = Intern(raw_condition.fact_);
+                new_instruction.target_.float_ = raw_condition.target_;
+                break;
+            }
+            case utility::ExpertSystemTypes::kEnum: {
+                // Gather the raw Condition and copy its contents, the enum target is resolved on the first run
+                auto& raw_condition = std::get<knowledge::rules::EnumCondition>(condition.condition_);
+                new_instruction.op_code_ = Fuse(OpCode::kEnumEqualTo, raw_condition.condition_);
+                new_instruction.invert_ = raw_condition.invert_;
+                new_instruction.confidence_factor_ = raw_condition.confidence_factor_.Get();
+                new_instruction.fact_ = Intern(raw_condition.fact_);
+                new_instruction.target_.enum_ = Intern(raw_condition.target_);
+                break;
+            }
+            default: {
+                // Keep the kUnknown operation
+                break;
+            }
+        }
+
+        // Store the instruction
+        instructions_.push_back(new_instruction);
+    }
+
+    std::uint32_t BytecodeProgram::Intern(const std::string& value) {
+        // Reuse the existing copy of the string, if there is one
+        auto search_result = string_indices_.find(value);
+        if (search_result != string_indices_.end()) {
+            return search_result->second;
+        }
+
+        // Store a new copy of the string
+        auto new_index = static_cast<std::uint32_t>(strings_.size());
+        strings_.push_back(value);
+        string_indices_.emplace(value, new_index);
+        return new_index;
+    }
+
+    knowledge::rules::TestOutcome BytecodeProgram::Execute(Instruction& instruction,
+                                                           knowledge::facts::FactDatabase& source,
+                                                           bool& comparison) {
+        // Catch the operations that never load a Fact
+        if (instruction.op_code_ == OpCode::kUnknown) {
+            return knowledge::rules::TestOutcome::kUnknown;
+        }
+        if (instruction.op_code_ == OpCode::kInvalidCondition) {
+            return knowledge::rules::TestOutcome::kInvalidCondition;
+        }
+
+        // Load the target Fact's slot
+        auto find_result = source.Find(strings_[instruction.fact_], instruction.binding_);
+        if (!find_result.has_value()) {
+            return knowledge::rules::TestOutcome::kInvalidFactIdentifier;
+        }
+        auto& target_fact = find_result->get();
+
+        // Check the Fact's type, then compare its session value from the FactDatabase's store
+        // Only Boolean Conditions check the confidence factor, matching the Condition::Test() specializations
+        switch (instruction.op_code_) {
+            case OpCode::kBoolEqualTo:
+            case OpCode::kBoolLessThan:
+            case OpCode::kBoolGreaterThan: {
+                if (target_fact.type_ != utility::ExpertSystemTypes::kBool) {
+                    return knowledge::rules::TestOutcome::kInvalidFactType;
+                }
+                return Compare(source.GetValue<bool>(instruction.binding_.handle_), instruction.target_.bool_, instruction, true, comparison);
+            }
+            case OpCode::kIntEqualTo:
+            case OpCode::kIntLessThan:
+            case OpCode::kIntGreaterThan: {
+                if (target_fact.type_ != utility::ExpertSystemTypes::kInt) {
+                    return knowledge::rules::TestOutcome::kInvalidFactType;
+                }
+                return Compare(source.GetValue<int>(instruction.binding_.handle_), instruction.target_.int_, instruction, false, comparison);
+            }
+            case OpCode::kFloatEqualTo:
+            case OpCode::kFloatLessThan:
+            case OpCode::kFloatGreaterThan: {
+                if (target_fact.type_ != utility::ExpertSystemTypes::kFloat) {
+                    return knowledge::rules::TestOutcome::kInvalidFactType;
+                }
+                return Compare(source.GetValue<float>(instruction.binding_.handle_), instruction.target_.float_, instruction, false, comparison);
+            }
+            case OpCode::kEnumEqualTo:
+            case OpCode::kEnumLessThan:
+            case OpCode::kEnumGreaterThan: {
+                if (target_fact.type_ != utility::ExpertSystemTypes::kEnum) {
+                    return knowledge::rules::TestOutcome::kInvalidFactType;
+                }
+
+                auto& raw_fact = std::get<knowledge::facts::EnumFact>(target_fact.fact_);
+                return Compare(source.GetValue<int>(instruction.binding_.handle_), raw_fact.enum_.At(strings_[instruction.target_.enum_], instruction.enum_binding_),
+                               instruction, false, comparison);
+            }
+            default: {
+                // Catch and indicate failure
+                return knowledge::rules::TestOutcome::kInvalidCondition;
+            }
+        }
+    }
+
+} // namespace expert_system::engines::inference
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "knowledge/facts/FactDatabase.hpp"
+#include "knowledge/facts/FactHandle.hpp"
+#include "knowledge/rules/Condition.hpp"
+#include "knowledge/rules/Conditions.hpp"
+#include "utility/DynamicEnum.hpp"
+
+namespace expert_system::engines::inference {
+
+        /**
+         * @brief The operations of a compiled Condition.
+         * Each test operation fuses the Fact's type with the Condition's comparison.
+         */
+    enum class OpCode : std::uint8_t {
+        kUnknown,
+        kInvalidCondition,
+        kBoolEqualTo,
+        kBoolLessThan,
+        kBoolGreaterThan,
+        kIntEqualTo,
+        kIntLessThan,
+        kIntGreaterThan,
+        kFloatEqualTo,
+        kFloatLessThan,
+        kFloatGreaterThan,
+        kEnumEqualTo,
+        kEnumLessThan,
+        kEnumGreaterThan
+    };
+
+        /**
+         * @brief A single compiled Condition.
+         * Loads the target Fact's slot, and compares its session value with an immediate target.
+         */
+    struct Instruction {
+            /// The operation to perform.
+        OpCode op_code_;
+
+            /// A flag to indicate if the comparison should be inverted.
+        bool invert_;
+
+            /// The Condition's minimum required confidence factor.
+        float confidence_factor_;
+
+            /// The index of the target Fact's name in the program's string pool.
+        std::uint32_t fact_;
+
+            /// The target value for the comparison, the enum target is an index into the string pool.
+        union {
+            bool bool_;
+            int int_;
+            float float_;
+            std::uint32_t enum_;
+        } target_;
+
+            /// The cached FactHandle of the target Fact, bound on the first lookup.
+        knowledge::facts::FactBinding binding_;
+
+            /// The cached position of the enum target in the Fact's DynamicEnum, only used by enum comparisons.
+        utility::EnumBinding enum_binding_;
+    };
+
+        /**
+         * @brief A set of Conditions compiled into a single contiguous array of instructions.
+         * Produces the same TestOutcome as VariantCondition::Test(), without visiting the Condition's variant.
+         * @note Compiled Conditions are copies, so they must be compiled again after the Rules are edited.
+         */
+    class BytecodeProgram {
+    public:
+            /// Default constructor, creates an empty program.
+        BytecodeProgram() = default;
+
+            /**
+             * @brief Compiles a single Condition into the program.
+             * @param [in] condition The Condition to compile.
+             * @return The entry point for running the compiled Condition.
+             */
+        std::size_t Compile(knowledge::rules::VariantCondition& condition);
+
+            /**
+             * @brief Runs a compiled Condition.
+             * @param [in] entry The entry point returned when it was compiled.
+             * @param [in] source The Fact Database to operate on.
+             * @return A TestOutcome enum symbol indicating the test's result.
+             */
+        knowledge::rules::TestOutcome Run(std::size_t entry, knowledge::facts::FactDatabase& source);
+
+            /**
+             * @brief Gathers the amount of compiled instructions.
+             * @return The amount of instructions.
+             */
+        [[nodiscard]] std::size_t Size() const;
+
+            /// Discards every compiled instruction.
+        void Clear();
+
+    private:
+            /**
+             * @brief Appends the instruction for a Condition.
+             * @param [in] condition The Condition to compile.
+             */
+        void Append(knowledge::rules::VariantCondition& condition);
+
+            /**
+             * @brief Adds a string to the string pool.
+             * @param [in] value The string to add.
+             * @return The index of the string.
+             */
+        std::uint32_t Intern(const std::string& value);
+
+            /**
+             * @brief Performs a single instruction's comparison.
+             * @param [in] instruction The instruction to perform.
+             * @param [in] source The Fact Database to operate on.
+             * @param [out] comparison The result of the comparison, only valid on success.
+             * @return kComparisonSuccess if the comparison was performed, or the error outcome otherwise.
+             */
+        knowledge::rules::TestOutcome Execute(Instruction& instruction, knowledge::facts::FactDatabase& source,
+                                              bool& comparison);
+
+            /// The compiled instructions, indexed by entry point.
+        std::vector<Instruction> instructions_;
+
+            /// The Fact names and enum targets used by the instructions.
+        std::vector<std::string> strings_;
+
+            /// Maps each pooled string to its index, so that each is only stored once.
+        std::unordered_map<std::string, std::uint32_t> string_indices_;
+    };
+
+} // namespace expert_system::engines::inference
@@ -1,12 +1,242 @@
 #include "Forward.hpp"
 
 #include <algorithm>
+#include <functional>
+#include <mutex>
 #include <set>
+#include <utility>
+#include <variant>
+#include <vector>
 
 #include "knowledge/facts/Values.hpp"
+#include "utility/Counters.hpp"
 
 namespace expert_system::engines::inference::forward {
 
+    namespace {
+
+            /// An Assignment that has been checked against its Fact, but not yet applied.
+        struct PendingAssignment {
+                /// The name of the target Fact.
+            std::string fact_;
+
+                /// False if the Assignment is attempted and logged, True if its type is unknown.
+            bool skipped_ = true;
+
+                /// The FactHandle of the target Fact, or std::nullopt if the Assignment will fail.
+            std::optional<knowledge::facts::FactHandle> handle_;
+
+                /// The reason the Assignment will fail, or std::nullopt if it may succeed.
+            std::optional<utility::Counter> rejection_;
+
+                /// The session value to assign, enum values are stored as DynamicEnum index values.
+            std::variant<std::monostate, bool, int, float> value_;
+
+                /// The Assignment's confidence factor.
+            utility::Confidence confidence_factor_;
+        };
+
+            /**
+             * @brief Checks a raw Assignment against its target Fact, identically to Assignment::Assign().
+             * @tparam T The raw type of the Assignment.
+             * @tparam RawValue The raw type of the session value, enum values use int.
+             * @param [in] raw_assignment The Assignment to check, only its FactBinding is changed.
+             * @param [in] type The ExpertSystemTypes that the target Fact must have.
+             * @param [in] value The session value to assign.
+             * @param [in] fact_database The Fact Database to check the Assignment against.
+             * @return The checked Assignment.
+             */
+        template<class T, class RawValue>
+        PendingAssignment Check(knowledge::rules::Assignment<T>& raw_assignment, utility::ExpertSystemTypes type,
+                                std::optional<RawValue> value, const knowledge::facts::FactDatabase& fact_database) {
+            // Keep track of the Assignment
+            PendingAssignment pending;
+            pending.fact_ = raw_assignment.fact_;
+            pending.skipped_ = false;
+            pending.confidence_factor_ = raw_assignment.confidence_factor_;
+
+            // Catch a missing Fact, a mismatching type, or an invalid value
+            auto optional_fact = fact_database.Find(raw_assignment.fact_, raw_assignment.binding_);
+            if (!optional_fact.has_value()) {
+                // Stop, the Assignment will fail
+                pending.rejection_ = utility::Counter::kRejectedMissingFact;
+                return pending;
+            }
+            if (optional_fact->get().type_ != type) {
+                // Stop, the Assignment will fail
+                pending.rejection_ = utility::Counter::kRejectedTypeMismatch;
+                return pending;
+            }
+            if (!value.has_value()) {
+                // Stop, the enum value does not exist
+                pending.rejection_ = utility::Counter::kRejectedOutOfRange;
+                return pending;
+            }
+            pending.rejection_ = fact_database.CheckValue<RawValue>(raw_assignment.binding_.handle_, value.value());
+            if (pending.rejection_.has_value()) {
+                // Stop, the Assignment will fail
+                return pending;
+            }
+
+            // Store the session value to assign
+            pending.handle_ = raw_assignment.binding_.handle_;
+            pending.value_ = value.value();
+            return pending;
+        }
+
+            /**
+             * @brief Checks each Assignment of a Consequent against its target Fact.
+             * @param [in] consequent The Consequent to check, only its Assignments' FactBindings are changed.
+             * @param [in] fact_database The Fact Database to check the Assignments against.
+             * @return The checked Assignments, in the Consequent's order.
+             */
+        std::vector<PendingAssignment> Check(knowledge::rules::Consequent& consequent,
+                                             const knowledge::facts::FactDatabase& fact_database) {
+            // Check each stored Assignment
+            std::vector<PendingAssignment> pending_assignments;
+            pending_assignments.reserve(consequent.assignments_.size());
+            for (auto& current_assignment: consequent.assignments_) {
+                // Process the specific type of stored Assignment
+                switch (current_assignment.type_) {
+                    case utility::ExpertSystemTypes::kBool: {
+                        auto& raw_assignment = std::get<knowledge::rules::BoolAssignment>(current_assignment.assignment_);
+                        pending_assignments.push_back(Check(raw_assignment, current_assignment.type_,
+                                                            std::optional<bool>(raw_assignment.value_), fact_database));
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kInt: {
+                        auto& raw_assignment = std::get<knowledge::rules::IntAssignment>(current_assignment.assignment_);
+                        pending_assignments.push_back(Check(raw_assignment, current_assignment.type_,
+                                                            std::optional<int>(raw_assignment.value_), fact_database));
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kFloat: {
+                        auto& raw_assignment = std::get<knowledge::rules::FloatAssignment>(current_assignment.assignment_);
+                        pending_assignments.push_back(Check(raw_assignment, current_assignment.type_,
+                                                            std::optional<float>(raw_assignment.value_), fact_database));
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kEnum: {
+                        // Convert the enum value's name into its index value
+                        auto& raw_assignment = std::get<knowledge::rules::EnumAssignment>(current_assignment.assignment_);
+                        std::optional<int> enum_index;
+                        auto optional_fact = fact_database.Find(raw_assignment.fact_, raw_assignment.binding_);
+                        if (optional_fact.has_value()
+                            && (optional_fact->get().type_ == utility::ExpertSystemTypes::kEnum)) {
+                            enum_index = std::get<knowledge::facts::EnumFact>(optional_fact->get().fact_)
+                                    .enum_.At(raw_assignment.value_, raw_assignment.value_binding_);
+                        }
+                        pending_assignments.push_back(Check(raw_assignment, current_assignment.type_,
+                                                            enum_index, fact_database));
+                        break;
+                    }
+                    default: {
+                        // Just skip this Assignment
+                        pending_assignments.emplace_back();
+                        break;
+                    }
+                }
+            }
+
+            // Return the checked Assignments
+            return pending_assignments;
+        }
+
+            /**
+             * @brief Applies a checked Assignment, through the Fact Database's filter.
+             * @param [in] pending The checked Assignment.
+             * @param [in,out] fact_database The Fact Database to assign the session value in.
+             * @return True if the session value was assigned, False otherwise.
+             */
+        bool Apply(const PendingAssignment& pending, knowledge::facts::FactDatabase& fact_database) {
+            // Catch an Assignment that has already failed
+            if (!pending.handle_.has_value()) {
+                return false;
+            }
+
+            // Assign the session value with its raw type
+            if (auto bool_value = std::get_if<bool>(&pending.value_)) {
+                return fact_database.SetValue<bool>(pending.handle_.value(), *bool_value, pending.confidence_factor_);
+            }
+            if (auto int_value = std::get_if<int>(&pending.value_)) {
+                return fact_database.SetValue<int>(pending.handle_.value(), *int_value, pending.confidence_factor_);
+            }
+            if (auto float_value = std::get_if<float>(&pending.value_)) {
+                return fact_database.SetValue<float>(pending.handle_.value(), *float_value, pending.confidence_factor_);
+            }
+            return false;
+        }
+
+            /**
+             * @brief Runs ThreadPool::ParallelFor(), adding the counts from every worker thread to the caller's Counters.
+             * @param [in] worker_pool The worker threads to run the batches on.
+             * @param [in] count The amount of indices.
+             * @param [in] batch_size The maximum amount of indices taken at once.
+             * @param [in] body The function to run for each batch.
+             */
+        void CountedParallelFor(utility::ThreadPool& worker_pool, std::size_t count, std::size_t batch_size,
+                                const std::function<void(std::size_t, std::size_t)>& body) {
+            // Catch if the caller is not counting
+            auto caller_counters = utility::CounterScope::Active();
+            if (caller_counters == nullptr) {
+                worker_pool.ParallelFor(count, batch_size, body);
+                return;
+            }
+
+            // Count each batch separately, as the caller's Counters are only active on the caller's thread
+            std::mutex counters_mutex;
+            worker_pool.ParallelFor(count, batch_size, [&](std::size_t batch_begin, std::size_t batch_end) {
+                utility::Counters batch_counters;
+                {
+                    utility::CounterScope counter_scope(&batch_counters);
+                    body(batch_begin, batch_end);
+                }
+
+                // Add the batch's counts to the caller's Counters
+                std::lock_guard<std::mutex> lock(counters_mutex);
+                caller_counters->Merge(batch_counters);
+            });
+        }
+
+            /**
+             * @brief Runs the triggered Rules' Consequents, recording the outcomes as a new step of a LogSink.
+             * Matches RunTriggered() with a MatchNetwork, without building a Log for each Rule.
+             * @param [in] triggered_rules A list of the triggered Rules.
+             * @param [in,out] fact_database The database of Facts to operate on.
+             * @param [in,out] network The match network to propagate the assigned session values through.
+             * @param [in,out] trace The LogSink to record the step in.
+             */
+        void RecordTriggered(
+                const std::list<std::map<std::string, knowledge::rules::Rule>::iterator>& triggered_rules,
+                knowledge::facts::FactDatabase& fact_database,
+                MatchNetwork& network,
+                explanation::LogSink& trace) {
+            // Run each of the triggered Rules as an event of a new step
+            trace.BeginStep();
+            std::vector<std::map<std::string, bool>> rule_outcomes;
+            rule_outcomes.reserve(triggered_rules.size());
+            for (const auto& current_rule: triggered_rules) {
+                // Attempt the Rule's assignment and record the session values of its Facts
+                rule_outcomes.push_back(current_rule->second.response_.Assign(fact_database));
+                trace.BeginEvent(current_rule);
+                for (const auto& current_outcome: rule_outcomes.back()) {
+                    trace.Record(current_outcome.first, fact_database);
+                }
+
+                // Update the Rule to keep track of it already being triggered
+                current_rule->second.successful_response_ = true;
+            }
+
+            // Propagate the Facts that each Rule attempted to assign through the network, once every Rule has run
+            for (const auto& current_outcomes: rule_outcomes) {
+                for (const auto& current_outcome: current_outcomes) {
+                    network.Update(current_outcome.first, fact_database);
+                }
+            }
+        }
+
+    } // namespace
+
     explanation::Log LogExisting(knowledge::facts::FactDatabase& fact_database) {
         // Create a log to store all of the existing session values
         explanation::Log data_log;
@@ -16,16 +246,8 @@ namespace expert_system::engines::inference::forward {
 
         // For each of the gathered identifiers
         for (auto& current_fact_name: facts_with_value) {
-            // Get the actual Fact
-            auto search_result = fact_database.Find(current_fact_name);
-
-            // Catch if the returned Fact is actually valid
-            if (search_result.has_value()) {
-                // Store the Fact name and Value in the log
-                data_log.assignments_.emplace(
-                        current_fact_name,
-                        knowledge::facts::VariantValue(search_result.value().get()));
-            }
+            // Store the Fact name and Value in the log
+            data_log.assignments_.emplace(current_fact_name, fact_database.GetVariantValue(current_fact_name));
         }
 
         // Return the log
@@ -43,8 +265,7 @@ namespace expert_system::engines::inference::forward {
 
         // Gather the Fact and generate a log
         explanation::Log specific_log;
-        knowledge::facts::VariantValue specific_value(fact_database.Find(fact_name).value().get());
-        specific_log.assignments_.emplace(fact_name, specific_value);
+        specific_log.assignments_.emplace(fact_name, fact_database.GetVariantValue(fact_name));
         return specific_log;
     }
 
@@ -54,28 +275,23 @@ namespace expert_system::engines::inference::forward {
         // Keep track of the Facts for values that could be requested from the user
         std::set<std::string> total_requests;
 
-        // Get the identifiers of all of the Facts that lack a session value
-        auto facts_without_value = fact_database.List(knowledge::facts::FactFilter::kHasValue);
-
         // Iterate through the rules that have not yet been run
         auto unused_rules = rule_database.ListRules(
                 knowledge::rules::RuleFilter::kHasNotRunConsequent);
         for (const auto& current_rule: unused_rules) {
-            // Get the Facts that would be required to trigger this Rule
-            auto rule_requirements = current_rule->second.TriggerFacts();
-
-            // Identify which Facts could be requested from the user
-            std::set<std::string> rule_requests;
-            std::set_union(facts_without_value.begin(), facts_without_value.end(),
-                           rule_requirements.begin(), rule_requirements.end(),
-                           std::inserter(rule_requests, rule_requests.begin()));
+            // Stop early once every Fact has a session value, as nothing more could be requested
+            if (!fact_database.AnyUnknown()) {
+                break;
+            }
 
-            // Add these Facts to the combined target requests
-            std::set<std::string> temp_total_requests;
-            std::merge(total_requests.begin(), total_requests.end(),
-                       rule_requests.begin(), rule_requests.end(),
-                       std::inserter(temp_total_requests, temp_total_requests.begin()));
-            total_requests = temp_total_requests;
+            // Identify which of the Facts required to trigger this Rule lack a session value
+            for (const auto& current_fact_name: current_rule->second.TriggerFacts()) {
+                auto fact_handle = fact_database.Handle(current_fact_name);
+                if (fact_handle.has_value() && !fact_database.Known(fact_handle.value())) {
+                    // Add this Fact to the combined target requests
+                    total_requests.insert(current_fact_name);
+                }
+            }
         }
 
         // Return the set of requests
@@ -84,7 +300,8 @@ namespace expert_system::engines::inference::forward {
 
     std::list<std::map<std::string, knowledge::rules::Rule>::iterator> FindTriggered(
             knowledge::facts::FactDatabase& fact_database,
-            knowledge::rules::RuleDatabase& rule_database) {
+            knowledge::rules::RuleDatabase& rule_database,
+            knowledge::rules::EvaluationMode mode) {
         // Keep track of the triggered Rules
         std::list<std::map<std::string, knowledge::rules::Rule>::iterator> triggered_rules;
 
@@ -93,7 +310,7 @@ namespace expert_system::engines::inference::forward {
                 knowledge::rules::RuleFilter::kHasNotRunConsequent);
         for (const auto& current_rule: unused_rules) {
             // Test the current Rule
-            auto test_result = current_rule->second.trigger_.Test(fact_database);
+            auto test_result = current_rule->second.Test(fact_database, mode);
 
             // Check if the current Rule has successfully been triggered and run
             if ((test_result == knowledge::rules::TestOutcome::kComparisonSuccess)
@@ -107,6 +324,72 @@ namespace expert_system::engines::inference::forward {
         return triggered_rules;
     }
 
+    std::vector<knowledge::rules::RuleId> FindTriggeredIds(
+            const knowledge::facts::FactDatabase& fact_database,
+            knowledge::rules::RuleDatabase& rule_database,
+            knowledge::rules::EvaluationMode mode) {
+        // Keep track of the triggered Rules
+        std::vector<knowledge::rules::RuleId> triggered_rules;
+
+        // Iterate through the Rules that have not yet been run
+        for (auto current_id: rule_database.ListRuleIds(knowledge::rules::RuleFilter::kHasNotRunConsequent)) {
+            // Test the current Rule
+            auto test_result = rule_database.Find(current_id)->get().Test(fact_database, mode);
+
+            // Check if the current Rule has successfully been triggered and run
+            if ((test_result == knowledge::rules::TestOutcome::kComparisonSuccess)
+             || (test_result == knowledge::rules::TestOutcome::kComparisonFailure)) {
+                // Store the current Rule for future reference
+                triggered_rules.push_back(current_id);
+            }
+        }
+
+        // Return the triggered Rules
+        return triggered_rules;
+    }
+
+    std::list<std::map<std::string, knowledge::rules::Rule>::iterator> FindTriggered(
+            const knowledge::facts::FactDatabase& fact_database,
+            knowledge::rules::RuleDatabase& rule_database,
+            utility::ThreadPool& worker_pool,
+            knowledge::rules::EvaluationMode mode) {
+        // Gather the Rules that have not yet been run, in name order
+        auto unused_list = rule_database.ListRules(
+                knowledge::rules::RuleFilter::kHasNotRunConsequent);
+        std::vector<std::map<std::string, knowledge::rules::Rule>::iterator> unused_rules(
+                unused_list.begin(), unused_list.end());
+
+        // Test the Rules in small batches, each worker thread only writing to its own Rules and flags
+        constexpr std::size_t kBatchSize = 8;
+        std::vector<char> triggered_flags(unused_rules.size(), 0);
+        CountedParallelFor(worker_pool, unused_rules.size(), kBatchSize,
+                           [&](std::size_t batch_begin, std::size_t batch_end) {
+            for (auto rule_index = batch_begin; rule_index < batch_end; ++rule_index) {
+                // Test the current Rule, and flag it if it was triggered
+                auto test_result = unused_rules[rule_index]->second.Test(fact_database, mode);
+                triggered_flags[rule_index] = (test_result == knowledge::rules::TestOutcome::kComparisonSuccess)
+                        || (test_result == knowledge::rules::TestOutcome::kComparisonFailure);
+            }
+        });
+
+        // Merge the flagged Rules in name order, so that the outcome does not depend on the scheduling
+        std::list<std::map<std::string, knowledge::rules::Rule>::iterator> triggered_rules;
+        for (std::size_t rule_index = 0; rule_index < unused_rules.size(); ++rule_index) {
+            if (triggered_flags[rule_index]) {
+                triggered_rules.emplace_back(unused_rules[rule_index]);
+            }
+        }
+
+        // Return the triggered Rules
+        return triggered_rules;
+    }
+
+    std::list<std::map<std::string, knowledge::rules::Rule>::iterator> FindTriggered(
+            MatchNetwork& network) {
+        // The network already tracks which Rules can be fully tested
+        return network.Triggered();
+    }
+
     std::vector<explanation::Log> RunTriggered(
             std::list<std::map<std::string, knowledge::rules::Rule>::iterator> triggered_rules,
             knowledge::facts::FactDatabase& fact_database) {
@@ -124,11 +407,9 @@ namespace expert_system::engines::inference::forward {
 
             // Iterate through the outcomes of the assignments
             for (auto& current_outcome: assignment_outcomes) {
-                // Gather the assignment's Fact
-                auto assignment_fact = fact_database.Find(current_outcome.first).value();
-
-                // Add the assigned data to the Log
-                current_fact_log.assignments_.emplace(current_outcome.first, assignment_fact);
+                // Gather the assignment's session value and add it to the Log
+                current_fact_log.assignments_.emplace(current_outcome.first,
+                                                      fact_database.GetVariantValue(current_outcome.first));
             }
 
             // Update the Rule to keep track of it already being triggered
@@ -142,4 +423,328 @@ namespace expert_system::engines::inference::forward {
         return trigger_log;
     }
 
+    std::vector<explanation::Log> RunTriggered(
+            const std::vector<knowledge::rules::RuleId>& triggered_rules,
+            knowledge::facts::FactDatabase& fact_database,
+            knowledge::rules::RuleDatabase& rule_database) {
+        // Create a log for each Consequent run
+        std::vector<explanation::Log> trigger_log;
+        trigger_log.reserve(triggered_rules.size());
+
+        // Iterate through the triggered rules
+        for (auto current_id: triggered_rules) {
+            // Skip a Rule that has since been removed
+            auto current_rule = rule_database.Find(current_id);
+            if (!current_rule.has_value()) {
+                continue;
+            }
+
+            // Attempt the Rule's assignment and track the results
+            auto assignment_outcomes = current_rule->get().response_.Assign(fact_database);
+
+            // Create a Log for this Rule's attempted assignment
+            explanation::Log& current_fact_log = trigger_log.emplace_back();
+            current_fact_log.rule_ = rule_database.Iterator(current_id);
+            current_fact_log.rule_id_ = current_id;
+
+            // Iterate through the outcomes of the assignments
+            for (auto& current_outcome: assignment_outcomes) {
+                // Gather the assignment's session value and add it to the Log
+                current_fact_log.assignments_.emplace(current_outcome.first,
+                                                      fact_database.GetVariantValue(current_outcome.first));
+            }
+
+            // Update the Rule to keep track of it already being triggered
+            current_rule->get().successful_response_ = true;
+        }
+
+        // Return the logs from the triggered outcomes
+        return trigger_log;
+    }
+
+    std::vector<explanation::Log> RunTriggered(
+            std::list<std::map<std::string, knowledge::rules::Rule>::iterator> triggered_rules,
+            knowledge::facts::FactDatabase& fact_database,
+            MatchNetwork& network) {
+        // Run the triggered Rules
+        auto trigger_log = RunTriggered(std::move(triggered_rules), fact_database);
+
+        // Iterate through the Facts that each Rule attempted to assign
+        for (auto& current_log: trigger_log) {
+            for (auto& current_assignment: current_log.assignments_) {
+                // Propagate the Fact's session value through the network
+                network.Update(current_assignment.first, fact_database);
+            }
+        }
+
+        // Return the logs from the triggered outcomes
+        return trigger_log;
+    }
+
+    std::vector<explanation::Log> RunTriggered(
+            std::list<std::map<std::string, knowledge::rules::Rule>::iterator> triggered_rules,
+            knowledge::facts::FactDatabase& fact_database,
+            utility::ThreadPool& worker_pool,
+            WritePolicy policy,
+            std::vector<WriteConflict>& conflicts) {
+        // Check every Assignment on the worker threads, which only read the Fact Database
+        std::vector<std::map<std::string, knowledge::rules::Rule>::iterator> rules(
+                triggered_rules.begin(), triggered_rules.end());
+        std::vector<std::vector<PendingAssignment>> pending_assignments(rules.size());
+        const auto& checked_database = fact_database;
+        CountedParallelFor(worker_pool, rules.size(), 1, [&](std::size_t batch_begin, std::size_t batch_end) {
+            for (auto rule_index = batch_begin; rule_index < batch_end; ++rule_index) {
+                pending_assignments[rule_index] = Check(rules[rule_index]->second.response_, checked_database);
+            }
+        });
+
+        // Group the Assignments that can succeed by their target Fact, in the order they were triggered
+        std::map<std::string, std::vector<std::pair<std::size_t, std::size_t>>> fact_writes;
+        for (std::size_t rule_index = 0; rule_index < rules.size(); ++rule_index) {
+            for (std::size_t pending_index = 0; pending_index < pending_assignments[rule_index].size(); ++pending_index) {
+                const auto& current_pending = pending_assignments[rule_index][pending_index];
+                if (current_pending.rejection_.has_value()) {
+                    // Count the reason that the Assignment failed its check
+                    utility::Count(current_pending.rejection_.value());
+                } else if (current_pending.handle_.has_value()) {
+                    fact_writes[current_pending.fact_].emplace_back(rule_index, pending_index);
+                }
+            }
+        }
+
+        // Apply the Assignments, keeping track of the Rule whose session value was kept for each Fact
+        std::map<std::string, std::size_t> fact_winners;
+        std::vector<explanation::Log> trigger_log(rules.size());
+        auto log_rule = [&](std::size_t rule_index) {
+            // Copy the current session value of each Fact that the Rule attempted to assign
+            trigger_log[rule_index].rule_ = rules[rule_index];
+            for (const auto& current_pending: pending_assignments[rule_index]) {
+                if (!current_pending.skipped_) {
+                    trigger_log[rule_index].assignments_.insert_or_assign(
+                            current_pending.fact_, fact_database.GetVariantValue(current_pending.fact_));
+                }
+            }
+        };
+        if (policy == WritePolicy::kSequential) {
+            // Replay the Assignments in order, identically to the sequential RunTriggered()
+            for (std::size_t rule_index = 0; rule_index < rules.size(); ++rule_index) {
+                for (const auto& current_pending: pending_assignments[rule_index]) {
+                    if (Apply(current_pending, fact_database)) {
+                        fact_winners[current_pending.fact_] = rule_index;
+                    }
+                }
+                log_rule(rule_index);
+            }
+        } else {
+            // Keep a single session value for each Fact
+            for (const auto& [fact_name, writes]: fact_writes) {
+                auto kept_write = writes.front();
+                for (const auto& current_write: writes) {
+                    const auto& current_pending = pending_assignments[current_write.first][current_write.second];
+                    const auto& kept_pending = pending_assignments[kept_write.first][kept_write.second];
+                    switch (policy) {
+                        case WritePolicy::kHighestConfidence: {
+                            // Keep the most confident session value
+                            if (kept_pending.confidence_factor_.Get() < current_pending.confidence_factor_.Get()) {
+                                kept_write = current_write;
+                            }
+                            break;
+                        }
+                        case WritePolicy::kPriority: {
+                            // Keep the session value of the Rule with the highest priority
+                            if (rules[kept_write.first]->second.priority_ < rules[current_write.first]->second.priority_) {
+                                kept_write = current_write;
+                            }
+                            break;
+                        }
+                        default: {
+                            // Keep the first session value
+                            break;
+                        }
+                    }
+                }
+
+                // Apply the kept session value in the batch
+                if (Apply(pending_assignments[kept_write.first][kept_write.second], fact_database)) {
+                    fact_winners[fact_name] = kept_write.first;
+                }
+            }
+
+            // Log the session values after the batch
+            for (std::size_t rule_index = 0; rule_index < rules.size(); ++rule_index) {
+                log_rule(rule_index);
+            }
+        }
+
+        // Report the Facts that were assigned by more than one Rule
+        conflicts.clear();
+        for (const auto& [fact_name, writes]: fact_writes) {
+            WriteConflict current_conflict;
+            current_conflict.fact_ = fact_name;
+            for (const auto& current_write: writes) {
+                if (current_conflict.rules_.empty() || (current_conflict.rules_.back() != rules[current_write.first])) {
+                    current_conflict.rules_.push_back(rules[current_write.first]);
+                }
+            }
+            if (current_conflict.rules_.size() < 2) {
+                continue;
+            }
+            auto winner = fact_winners.find(fact_name);
+            if (winner != fact_winners.end()) {
+                current_conflict.winner_ = rules[winner->second];
+            }
+            conflicts.push_back(std::move(current_conflict));
+        }
+
+        // Update the Rules to keep track of them already being triggered
+        for (auto& current_rule: rules) {
+            current_rule->second.successful_response_ = true;
+        }
+
+        // Return the logs from the triggered outcomes
+        return trigger_log;
+    }
+
+    explanation::TraceStore RunToCompletion(
+            knowledge::facts::FactDatabase& fact_database,
+            knowledge::rules::RuleDatabase& rule_database,
+            profiling::Profiler* profiler) {
+        // Compile the Rules into a match network and run the consultation
+        MatchNetwork match_network(rule_database);
+        return RunToCompletion(fact_database, rule_database, match_network, profiler);
+    }
+
+    explanation::TraceStore RunToCompletion(
+            knowledge::facts::FactDatabase& fact_database,
+            knowledge::rules::RuleDatabase& rule_database,
+            MatchNetwork& network,
+            profiling::Profiler* profiler) {
+        // Keep track of the events that occur while inferring, in memory
+        explanation::TraceStore trace(rule_database);
+        RunToCompletion(fact_database, rule_database, network, trace, profiler);
+        return trace;
+    }
+
+    void RunToCompletion(
+            knowledge::facts::FactDatabase& fact_database,
+            knowledge::rules::RuleDatabase& /*rule_database*/,
+            MatchNetwork& network,
+            explanation::LogSink& trace,
+            profiling::Profiler* profiler) {
+        // Test the network against the current values, as part of the first round
+        if (profiler != nullptr) {
+            profiler->BeginCycle();
+        }
+        {
+            profiling::Measurement measurement(profiler, profiling::Phase::kMatch);
+            network.Synchronize(fact_database);
+        }
+
+        // Continue to loop through the inference process
+        while (true) {
+            // Catch if no more Rules can be triggered without the user
+            std::list<std::map<std::string, knowledge::rules::Rule>::iterator> trigger_list;
+            {
+                profiling::Measurement measurement(profiler, profiling::Phase::kMatch);
+
+                // Catch if any facts do not have a session value
+                if (!fact_database.AnyUnknown()) {
+                    break;
+                }
+
+                // Catch if any rules have not yet been triggered
+                if (!network.AnyNotRun()) {
+                    break;
+                }
+
+                // Gather the triggered Rules from the network
+                trigger_list = FindTriggered(network);
+                if (trigger_list.empty()) {
+                    break;
+                }
+            }
+
+            // Run the triggered Rule's Consequents and log the outcomes
+            {
+                profiling::Measurement measurement(profiler, profiling::Phase::kFire);
+                RecordTriggered(trigger_list, fact_database, network, trace);
+            }
+
+            // Start measuring the next round
+            if (profiler != nullptr) {
+                profiler->BeginCycle();
+            }
+        }
+
+        // Write out any events that the LogSink is still holding
+        trace.Flush();
+    }
+
+    explanation::TraceStore RunToCompletion(
+            knowledge::facts::FactDatabase& fact_database,
+            knowledge::rules::RuleDatabase& rule_database,
+            MatchNetwork& network,
+            Agenda& agenda,
+            profiling::Profiler* profiler) {
+        // Keep track of the events that occur while inferring, in memory
+        explanation::TraceStore trace(rule_database);
+        RunToCompletion(fact_database, network, agenda, trace, profiler);
+        return trace;
+    }
+
+    void RunToCompletion(
+            knowledge::facts::FactDatabase& fact_database,
+            MatchNetwork& network,
+            Agenda& agenda,
+            explanation::LogSink& trace,
+            profiling::Profiler* profiler) {
+        // Test the network against the current values, and fill the Agenda with the triggered Rules
+        if (profiler != nullptr) {
+            profiler->BeginCycle();
+        }
+        {
+            profiling::Measurement measurement(profiler, profiling::Phase::kMatch);
+            agenda.Clear();
+            network.Synchronize(fact_database);
+            network.Attach(&agenda);
+        }
+
+        // Continue to loop through the inference process
+        while (true) {
+            // Catch if no more Rules can be triggered without the user
+            std::optional<std::map<std::string, knowledge::rules::Rule>::iterator> next_rule;
+            {
+                profiling::Measurement measurement(profiler, profiling::Phase::kMatch);
+
+                // Catch if any facts do not have a session value
+                if (!fact_database.AnyUnknown()) {
+                    break;
+                }
+
+                // Take the first activation from the Agenda
+                next_rule = agenda.Pop();
+                if (!next_rule.has_value()) {
+                    break;
+                }
+            }
+
+            // Run the Rule's Consequent and log the outcome, the network updates the Agenda
+            {
+                profiling::Measurement measurement(profiler, profiling::Phase::kFire);
+                RecordTriggered({next_rule.value()}, fact_database, network, trace);
+            }
+
+            // Start measuring the next Rule
+            if (profiler != nullptr) {
+                profiler->BeginCycle();
+            }
+        }
+
+        // Detach the Agenda, so the network no longer refers to it
+        network.Attach(nullptr);
+
+        // Write out any events that the LogSink is still holding
+        trace.Flush();
+    }
+
 } // namespace expert_system::engines::inference::forward
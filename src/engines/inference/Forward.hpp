@@ -1,15 +1,54 @@
 #pragma once
 
+#include <map>
 #include <optional>
 #include <set>
+#include <string>
 #include <vector>
 
+#include "nlohmann/json.hpp"
+
 #include "knowledge/facts/FactDatabase.hpp"
 #include "knowledge/rules/RuleDatabase.hpp"
 #include "engines/explanation/Log.hpp"
+#include "engines/explanation/LogSink.hpp"
+#include "engines/explanation/TraceStore.hpp"
+#include "engines/inference/Agenda.hpp"
+#include "engines/inference/MatchNetwork.hpp"
+#include "engines/profiling/Profiler.hpp"
+#include "utility/ThreadPool.hpp"
 
 namespace expert_system::engines::inference::forward {
 
+        /// The symbolic representations of the ways to resolve several Rules assigning the same Fact in one round.
+    enum class WritePolicy {
+        kUnknown,
+        kSequential,
+        kHighestConfidence,
+        kPriority,
+        kFirstInOrder
+    };
+
+        /// JSON serialization for the WritePolicy enum.
+    NLOHMANN_JSON_SERIALIZE_ENUM(WritePolicy,
+                                 {{WritePolicy::kUnknown, nullptr},
+                                  {WritePolicy::kSequential, "Sequential"},
+                                  {WritePolicy::kHighestConfidence, "HighestConfidence"},
+                                  {WritePolicy::kPriority, "Priority"},
+                                  {WritePolicy::kFirstInOrder, "FirstInOrder"}})
+
+        /// A Fact that was assigned by more than one Rule in a single round.
+    struct WriteConflict {
+            /// The name of the Fact.
+        std::string fact_;
+
+            /// The Rules that assigned the Fact, in the order they were triggered.
+        std::vector<std::map<std::string, knowledge::rules::Rule>::iterator> rules_;
+
+            /// The Rule whose session value was kept, or std::nullopt if every session value was rejected.
+        std::optional<std::map<std::string, knowledge::rules::Rule>::iterator> winner_;
+    };
+
         /**
          * @brief Creates a log for the existing Facts stored in a provided database.
          * @param fact_database The database of Facts to operate on.
@@ -41,11 +80,54 @@ namespace expert_system::engines::inference::forward {
          * @brief Identifies which Rules have been triggered by the current state of a Fact Database.
          * @param fact_database The database of Facts to operate on.
          * @param rule_database The database of Rules to operate on.
+         * @param mode The evaluation mode of each Antecedent, see Antecedent::Test().
          * @return A set of iterators, each pointing to the Rules within the provided rule database.
+         * @note Each Test is recorded in the Rule's statistics.
          */
     std::list<std::map<std::string, knowledge::rules::Rule>::iterator> FindTriggered(
             knowledge::facts::FactDatabase& fact_database,
-            knowledge::rules::RuleDatabase& rule_database);
+            knowledge::rules::RuleDatabase& rule_database,
+            knowledge::rules::EvaluationMode mode = knowledge::rules::EvaluationMode::kComplete);
+
+        /**
+         * @brief Identifies which Rules have been triggered, testing the Rules on a pool of worker threads.
+         * The Rules are split between the worker threads, which only read the Fact Database while testing.
+         * @param fact_database The database of Facts to operate on, which must not be changed until this returns.
+         * @param rule_database The database of Rules to operate on.
+         * @param worker_pool The worker threads to test the Rules on.
+         * @param mode The evaluation mode of each Antecedent, see Antecedent::Test().
+         * @return A set of iterators, each pointing to the Rules within the provided rule database.
+         * @note The triggered Rules are listed in name order, identically to the sequential overload.
+         * @note Each Test is recorded in the Rule's statistics.
+         */
+    std::list<std::map<std::string, knowledge::rules::Rule>::iterator> FindTriggered(
+            const knowledge::facts::FactDatabase& fact_database,
+            knowledge::rules::RuleDatabase& rule_database,
+            utility::ThreadPool& worker_pool,
+            knowledge::rules::EvaluationMode mode = knowledge::rules::EvaluationMode::kComplete);
+
+        /**
+         * @brief Identifies which Rules have been triggered, referring to them by RuleId.
+         * @param fact_database The database of Facts to operate on.
+         * @param rule_database The database of Rules to operate on.
+         * @param mode The evaluation mode of each Antecedent, see Antecedent::Test().
+         * @return A list of the RuleIds of the triggered Rules, in name order.
+         * @note Equivalent to the sequential FindTriggered(), the RuleIds stay valid if other Rules are removed.
+         * @note Each Test is recorded in the Rule's statistics.
+         */
+    std::vector<knowledge::rules::RuleId> FindTriggeredIds(
+            const knowledge::facts::FactDatabase& fact_database,
+            knowledge::rules::RuleDatabase& rule_database,
+            knowledge::rules::EvaluationMode mode = knowledge::rules::EvaluationMode::kComplete);
+
+        /**
+         * @brief Identifies which Rules have been triggered, using the cached outcomes of a match network.
+         * @param network The match network, synchronized with the current state of the Fact Database.
+         * @return A set of iterators, each pointing to the Rules within the network's rule database.
+         * @note Only proportional to the amount of triggered Rules, not the size of the rule database.
+         */
+    std::list<std::map<std::string, knowledge::rules::Rule>::iterator> FindTriggered(
+            MatchNetwork& network);
 
         /**
          * @brief Runs a set of provided Rules, generating logs for the Assignment action of each.
@@ -57,4 +139,128 @@ namespace expert_system::engines::inference::forward {
             std::list<std::map<std::string, knowledge::rules::Rule>::iterator> triggered_rules,
             knowledge::facts::FactDatabase& fact_database);
 
+        /**
+         * @brief Runs a set of provided Rules by RuleId, generating logs for the Assignment action of each.
+         * @param triggered_rules The RuleIds of the Rules to action.
+         * @param fact_database The database of Facts to operate on.
+         * @param rule_database The database of Rules that issued the RuleIds.
+         * @return A set of logs, one for each Rule that had successfully run its Assignment action.
+         * @note RuleIds of Rules that have since been removed are skipped.
+         */
+    std::vector<explanation::Log> RunTriggered(
+            const std::vector<knowledge::rules::RuleId>& triggered_rules,
+            knowledge::facts::FactDatabase& fact_database,
+            knowledge::rules::RuleDatabase& rule_database);
+
+        /**
+         * @brief Runs a set of provided Rules, propagating each Assignment through a match network.
+         * @param triggered_rules The set of Rules to action.
+         * @param fact_database The database of Facts to operate on.
+         * @param network The match network to keep synchronized with the Fact Database.
+         * @return A set of logs, one for each Rule that had successfully run its Assignment action.
+         */
+    std::vector<explanation::Log> RunTriggered(
+            std::list<std::map<std::string, knowledge::rules::Rule>::iterator> triggered_rules,
+            knowledge::facts::FactDatabase& fact_database,
+            MatchNetwork& network);
+
+        /**
+         * @brief Runs a set of provided Rules in separate phases, resolving Facts assigned by more than one Rule.
+         * Every Assignment is first checked against its Fact on the worker threads, without changing the Fact Database.
+         * The Facts targeted by more than one Rule are then resolved by the WritePolicy, and applied in one batch.
+         * @param triggered_rules The set of Rules to action, in the order they were triggered.
+         * @param fact_database The database of Facts to operate on.
+         * @param worker_pool The worker threads to check the Assignments on.
+         * @param policy How to resolve a Fact assigned by more than one Rule:
+         * kSequential replays the Assignments in order, producing identical results and logs to the sequential
+         * RunTriggered(). kHighestConfidence keeps the most confident session value, kPriority keeps the session value
+         * of the Rule with the highest priority, and kFirstInOrder keeps the first session value. Ties keep the
+         * earlier session value, and the kept session value is still filtered by any existing session value.
+         * @param [out] conflicts The Facts that were assigned by more than one Rule, in name order.
+         * @return A set of logs, one for each Rule, with the session values after the batch was applied.
+         */
+    std::vector<explanation::Log> RunTriggered(
+            std::list<std::map<std::string, knowledge::rules::Rule>::iterator> triggered_rules,
+            knowledge::facts::FactDatabase& fact_database,
+            utility::ThreadPool& worker_pool,
+            WritePolicy policy,
+            std::vector<WriteConflict>& conflicts);
+
+        /**
+         * @brief Repeatedly finds and runs the triggered Rules until no more Rules can be triggered.
+         * This is a consultation without the user, that never requests additional session values.
+         * @param fact_database The database of Facts to operate on.
+         * @param rule_database The database of Rules to operate on.
+         * @param profiler The Profiler to measure each round with, or nullptr to not measure the consultation.
+         * @return A TraceStore with a step for each round of triggered Rules, and an event for each Rule.
+         */
+    explanation::TraceStore RunToCompletion(
+            knowledge::facts::FactDatabase& fact_database,
+            knowledge::rules::RuleDatabase& rule_database,
+            profiling::Profiler* profiler = nullptr);
+
+        /**
+         * @brief Repeatedly finds and runs the triggered Rules, reusing an existing match network.
+         * @param fact_database The database of Facts to operate on.
+         * @param rule_database The database of Rules to operate on.
+         * @param network A match network compiled for the rule database, it will be synchronized before use.
+         * @param profiler The Profiler to measure each round with, or nullptr to not measure the consultation.
+         * @return A TraceStore with a step for each round of triggered Rules, and an event for each Rule.
+         * @note Avoids compiling the network again when running many consultations on the same Rules.
+         */
+    explanation::TraceStore RunToCompletion(
+            knowledge::facts::FactDatabase& fact_database,
+            knowledge::rules::RuleDatabase& rule_database,
+            MatchNetwork& network,
+            profiling::Profiler* profiler = nullptr);
+
+        /**
+         * @brief Repeatedly finds and runs the triggered Rules, streaming the events to a LogSink as they happen.
+         * @param fact_database The database of Facts to operate on.
+         * @param rule_database Unused, the network keeps track of the Rules that have not been run.
+         * @param network A match network compiled for the rule database, it will be synchronized before use.
+         * @param trace The LogSink to record a step for each round of triggered Rules in, with an event for each Rule.
+         * @param profiler The Profiler to measure each round with, or nullptr to not measure the consultation.
+         * @note The LogSink is flushed once the consultation stops.
+         */
+    void RunToCompletion(
+            knowledge::facts::FactDatabase& fact_database,
+            knowledge::rules::RuleDatabase& rule_database,
+            MatchNetwork& network,
+            explanation::LogSink& trace,
+            profiling::Profiler* profiler = nullptr);
+
+        /**
+         * @brief Repeatedly runs the first Rule on an Agenda until no more Rules can be triggered.
+         * Unlike the other overloads, a single Rule is run per event, in the order of the Agenda's ConflictStrategy.
+         * @param [in] fact_database The database of Facts to operate on.
+         * @param [in] rule_database The database of Rules that the network was compiled for.
+         * @param [in] network A match network compiled for the Rules, it will be synchronized before use.
+         * @param [in] agenda The Agenda to order the triggered Rules with, its existing activations are discarded.
+         * @param [in] profiler The Profiler to measure each Rule with, or nullptr to not measure the consultation.
+         * @return A TraceStore with a step for each Rule, containing its single event.
+         */
+    explanation::TraceStore RunToCompletion(
+            knowledge::facts::FactDatabase& fact_database,
+            knowledge::rules::RuleDatabase& rule_database,
+            MatchNetwork& network,
+            Agenda& agenda,
+            profiling::Profiler* profiler = nullptr);
+
+        /**
+         * @brief Repeatedly runs the first Rule on an Agenda, streaming the events to a LogSink as they happen.
+         * @param [in] fact_database The database of Facts to operate on.
+         * @param [in] network A match network compiled for the Rules, it will be synchronized before use.
+         * @param [in] agenda The Agenda to order the triggered Rules with, its existing activations are discarded.
+         * @param [in] trace The LogSink to record a step for each Rule in, containing its single event.
+         * @param [in] profiler The Profiler to measure each Rule with, or nullptr to not measure the consultation.
+         * @note The LogSink is flushed once the consultation stops.
+         */
+    void RunToCompletion(
+            knowledge::facts::FactDatabase& fact_database,
+            MatchNetwork& network,
+            Agenda& agenda,
+            explanation::LogSink& trace,
+            profiling::Profiler* profiler = nullptr);
+
 } // namespace expert_system::engines::inference::forward
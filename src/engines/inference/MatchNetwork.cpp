@@ -0,0 +1,196 @@
+#include "MatchNetwork.hpp"
+
+#include <set>
+
+#include "utility/Counters.hpp"
+
+namespace expert_system::engines::inference {
+
+    MatchNetwork::MatchNetwork(knowledge::rules::RuleDatabase& rule_database) {
+        // Compile the network for the provided Rules
+        Compile(rule_database);
+    }
+
+    void MatchNetwork::Compile(knowledge::rules::RuleDatabase& rule_database) {
+        // Discard the existing network
+        program_.Clear();
+        alpha_nodes_.clear();
+        if (agenda_ != nullptr) {
+            agenda_->Clear();
+        }
+        beta_nodes_.clear();
+        fact_alphas_.clear();
+        triggered_.clear();
+        not_run_ = 0;
+
+        // Iterate through the stored Rules
+        for (auto current_rule = rule_database.managed_rules_.begin();
+             current_rule != rule_database.managed_rules_.end(); ++current_rule) {
+            // Create the Rule's beta node
+            auto beta_index = beta_nodes_.size();
+            beta_nodes_.push_back(BetaNode{current_rule, 0, {},
+                                           knowledge::rules::TestOutcome::kUnknown});
+
+            // Create the alpha node for the Antecedent's root Condition
+            auto& antecedent = current_rule->second.trigger_;
+            auto root_index = AddAlpha(antecedent.root_condition_, beta_index);
+            beta_nodes_[beta_index].root_ = root_index;
+
+            // Create the alpha nodes for the Antecedent's chained Conditions
+            for (auto& current_pair: antecedent.condition_chain_) {
+                auto chained_index = AddAlpha(current_pair.second, beta_index);
+                beta_nodes_[beta_index].chain_.emplace_back(current_pair.first, chained_index);
+            }
+        }
+    }
+
+    void MatchNetwork::Synchronize(knowledge::facts::FactDatabase& fact_database) {
+        // Check every Rule again, in case they were reset
+        not_run_ = 0;
+
+        // Test every alpha node
+        for (auto& current_alpha: alpha_nodes_) {
+            utility::Count(utility::Counter::kConditionsEvaluated);
+            current_alpha.memory_ = program_.Run(current_alpha.entry_, fact_database);
+        }
+
+        // Recombine every beta node
+        for (std::size_t beta_index = 0; beta_index < beta_nodes_.size(); ++beta_index) {
+            Join(beta_index);
+        }
+    }
+
+    void MatchNetwork::Update(const std::string& fact_name,
+                              knowledge::facts::FactDatabase& fact_database) {
+        // Catch if no Conditions test the Fact
+        auto search_result = fact_alphas_.find(fact_name);
+        if (search_result == fact_alphas_.end()) {
+            // Nothing needs to be updated
+            return;
+        }
+
+        // Test the alpha nodes for the Fact, keeping track of the affected beta nodes
+        std::set<std::size_t> affected_betas;
+        for (auto alpha_index: search_result->second) {
+            auto& current_alpha = alpha_nodes_[alpha_index];
+            utility::Count(utility::Counter::kConditionsEvaluated);
+            current_alpha.memory_ = program_.Run(current_alpha.entry_, fact_database);
+            affected_betas.insert(current_alpha.beta_);
+        }
+
+        // Recombine only the affected beta nodes
+        for (auto beta_index: affected_betas) {
+            Join(beta_index);
+        }
+    }
+
+    std::list<std::map<std::string, knowledge::rules::Rule>::iterator> MatchNetwork::Triggered() {
+        // Keep track of the triggered Rules
+        std::list<std::map<std::string, knowledge::rules::Rule>::iterator> triggered_rules;
+
+        // Iterate through the beta nodes holding a comparison outcome
+        for (auto current_entry = triggered_.begin(); current_entry != triggered_.end();) {
+            // Catch if the Rule has already been run
+            auto& current_rule = beta_nodes_[current_entry->second].rule_;
+            if (current_rule->second.successful_response_) {
+                // The Rule can no longer be triggered, so stop tracking it
+                current_entry = triggered_.erase(current_entry);
+                continue;
+            }
+
+            // Store the current Rule for future reference
+            triggered_rules.emplace_back(current_rule);
+            ++current_entry;
+        }
+
+        // Return the triggered Rules
+        return triggered_rules;
+    }
+
+    bool MatchNetwork::AnyNotRun() {
+        // Skip past the Rules that have been run, which stay run until the network is synchronized
+        while ((not_run_ < beta_nodes_.size()) && beta_nodes_[not_run_].rule_->second.successful_response_) {
+            ++not_run_;
+        }
+
+        // Any remaining beta node belongs to a Rule that has not been run
+        return not_run_ < beta_nodes_.size();
+    }
+
+    void MatchNetwork::Attach(Agenda* agenda) {
+        // Store the Agenda
+        agenda_ = agenda;
+        if (agenda_ == nullptr) {
+            return;
+        }
+
+        // Add an activation for each triggered Rule that has not yet been run
+        for (auto& current_entry: triggered_) {
+            auto& current_rule = beta_nodes_[current_entry.second].rule_;
+            if (!current_rule->second.successful_response_) {
+                agenda_->Insert(current_rule);
+            }
+        }
+    }
+
+    std::size_t MatchNetwork::AddAlpha(knowledge::rules::VariantCondition& condition,
+                                       std::size_t beta) {
+        // Create the alpha node
+        auto alpha_index = alpha_nodes_.size();
+        alpha_nodes_.push_back(AlphaNode{program_.Compile(condition), beta,
+                                         knowledge::rules::TestOutcome::kUnknown});
+
+        // Index the alpha node by its target Fact, if it has one
+        auto fact_name = condition.Fact();
+        if (fact_name.has_value()) {
+            fact_alphas_[fact_name.value()].push_back(alpha_index);
+        }
+
+        // Return the index of the new alpha node
+        return alpha_index;
+    }
+
+    void MatchNetwork::Join(std::size_t beta) {
+        // Combine the cached outcomes, identically to Antecedent::Test()
+        utility::Count(utility::Counter::kRulesTested);
+        auto& beta_node = beta_nodes_[beta];
+        auto combined_outcomes = alpha_nodes_[beta_node.root_].memory_;
+        if ((combined_outcomes == knowledge::rules::TestOutcome::kComparisonSuccess)
+            || (combined_outcomes == knowledge::rules::TestOutcome::kComparisonFailure)) {
+            // Iterate through the chained alpha nodes in order
+            for (auto& current_pair: beta_node.chain_) {
+                // Catch an error output
+                auto local_outcome = alpha_nodes_[current_pair.second].memory_;
+                if ((local_outcome != knowledge::rules::TestOutcome::kComparisonSuccess)
+                    && (local_outcome != knowledge::rules::TestOutcome::kComparisonFailure)) {
+                    // Stop and keep the error output
+                    combined_outcomes = local_outcome;
+                    break;
+                }
+
+                // Chain the outcome with the specified ConnectorType
+                combined_outcomes = knowledge::rules::Chain(current_pair.first, combined_outcomes, local_outcome);
+            }
+        }
+        beta_node.memory_ = combined_outcomes;
+
+        // Keep track of whether the Antecedent could be fully tested
+        if ((combined_outcomes == knowledge::rules::TestOutcome::kComparisonSuccess)
+            || (combined_outcomes == knowledge::rules::TestOutcome::kComparisonFailure)) {
+            triggered_.emplace(beta_node.rule_->first, beta);
+
+            // Activate the Rule in the attached Agenda, unless it has already been run
+            if ((agenda_ != nullptr) && !beta_node.rule_->second.successful_response_) {
+                agenda_->Insert(beta_node.rule_);
+            }
+        } else {
+            triggered_.erase(beta_node.rule_->first);
+
+            // Deactivate the Rule in the attached Agenda
+            if (agenda_ != nullptr) {
+                agenda_->Remove(beta_node.rule_->first);
+            }
+        }
+    }
+
+} // namespace expert_system::engines::inference
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "engines/inference/Agenda.hpp"
+#include "engines/inference/Bytecode.hpp"
+#include "knowledge/facts/FactDatabase.hpp"
+#include "knowledge/rules/Antecedent.hpp"
+#include "knowledge/rules/Conditions.hpp"
+#include "knowledge/rules/RuleDatabase.hpp"
+
+namespace expert_system::engines::inference {
+
+        /**
+         * @brief A compiled match network for the Antecedents of a Rule Database.
+         * Caches the outcome of every Condition (alpha nodes) and every Antecedent chain (beta nodes),
+         * so that only the Rules reading a changed Fact are re-tested.
+         * The Conditions are compiled into a BytecodeProgram, so testing an alpha node never walks the Rules.
+         * @warning The network must be compiled again if the Rule Database's Rules are edited!
+         */
+    class MatchNetwork {
+    public:
+            /// Default constructor, creates an empty network.
+        MatchNetwork() = default;
+
+            /**
+             * @brief Parameterized constructor, compiles the network for a Rule Database.
+             * @param [in] rule_database The database of Rules to compile.
+             */
+        explicit MatchNetwork(knowledge::rules::RuleDatabase& rule_database);
+
+            /**
+             * @brief Discards the existing network and compiles a new one for a Rule Database.
+             * @param [in] rule_database The database of Rules to compile.
+             * @note All cached outcomes will be kUnknown until the network is synchronized.
+             */
+        void Compile(knowledge::rules::RuleDatabase& rule_database);
+
+            /**
+             * @brief Tests every alpha node and recombines every beta node.
+             * @param [in] fact_database The database of Facts to operate on.
+             * @note Required after compiling, or after session values are changed outside of Update().
+             */
+        void Synchronize(knowledge::facts::FactDatabase& fact_database);
+
+            /**
+             * @brief Propagates a change to a Fact's session value through the network.
+             * Only the alpha nodes testing the Fact, and the beta nodes depending upon them, are processed.
+             * @param [in] fact_name The name of the Fact with a changed session value.
+             * @param [in] fact_database The database of Facts to operate on.
+             */
+        void Update(const std::string& fact_name, knowledge::facts::FactDatabase& fact_database);
+
+            /**
+             * @brief Lists the Rules that have not yet been run, with an Antecedent that can be fully tested.
+             * @return A list of the iterators to the Rules, in the order of their names.
+             */
+        std::list<std::map<std::string, knowledge::rules::Rule>::iterator> Triggered();
+
+            /**
+             * @brief Checks if any of the network's Rules have not yet been run.
+             * Rules are only skipped once they have been run, so the check is amortized constant time.
+             * @return True if at least one Rule has not been run, False otherwise.
+             * @note Rules reset outside of the network are only seen again after synchronizing the network.
+             */
+        bool AnyNotRun();
+
+            /**
+             * @brief Attaches an Agenda, keeping its activations in step with the network.
+             * Un-run Rules are added to the Agenda as they become triggered, and removed as they stop being triggered.
+             * @param [in] agenda The Agenda to keep updated, or nullptr to detach the current Agenda.
+             * @note The Agenda is filled from the cached outcomes, so synchronize the network first.
+             */
+        void Attach(Agenda* agenda);
+
+    private:
+            /// A cached test of a single Condition.
+        struct AlphaNode {
+                /// The entry point of the compiled Condition to test.
+            std::size_t entry_;
+
+                /// The index of the beta node that the Condition belongs to.
+            std::size_t beta_;
+
+                /// The outcome of the Condition's most recent Test.
+            knowledge::rules::TestOutcome memory_;
+        };
+
+            /// A cached combination of the alpha nodes from a single Antecedent.
+        struct BetaNode {
+                /// The Rule that owns the Antecedent.
+            std::map<std::string, knowledge::rules::Rule>::iterator rule_;
+
+                /// The index of the alpha node for the Antecedent's root Condition.
+            std::size_t root_;
+
+                /// The indices of the alpha nodes for the Antecedent's chained Conditions.
+            std::vector<std::pair<knowledge::rules::ConnectorType, std::size_t>> chain_;
+
+                /// The outcome of the most recent combination.
+            knowledge::rules::TestOutcome memory_;
+        };
+
+            /**
+             * @brief Adds an alpha node to the network.
+             * @param [in] condition The Condition to test.
+             * @param [in] beta The index of the beta node that the Condition belongs to.
+             * @return The index of the new alpha node.
+             */
+        std::size_t AddAlpha(knowledge::rules::VariantCondition& condition, std::size_t beta);
+
+            /**
+             * @brief Recombines a beta node from its alpha nodes' cached outcomes.
+             * @param [in] beta The index of the beta node.
+             */
+        void Join(std::size_t beta);
+
+            /// The compiled Conditions of every alpha node.
+        BytecodeProgram program_;
+
+            /// The alpha nodes, one for each Condition of each Rule.
+        std::vector<AlphaNode> alpha_nodes_;
+
+            /// The beta nodes, one for each Rule.
+        std::vector<BetaNode> beta_nodes_;
+
+            /// Maps a Fact's name to the indices of the alpha nodes that test it.
+        std::unordered_map<std::string, std::vector<std::size_t>> fact_alphas_;
+
+            /// The beta nodes that currently hold a comparison outcome, mapped to their Rule's name.
+        std::map<std::string, std::size_t> triggered_;
+
+            /// The index of the first beta node whose Rule may not have been run yet.
+        std::size_t not_run_ = 0;
+
+            /// The attached Agenda, or nullptr if there is none.
+        Agenda* agenda_ = nullptr;
+    };
+
+} // namespace expert_system::engines::inference
@@ -0,0 +1,139 @@
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+namespace expert_system::engines::profiling {
+
+    void to_json(nlohmann::json& json_sys, const Cycle& target) {
+        // Export the counts
+        json_sys["counters"] = target.counters_;
+
+        // Export the wall time of each Phase
+        auto phase_time = nlohmann::json::object();
+        for (std::size_t phase_index = 1; phase_index < target.phase_time_.size(); ++phase_index) {
+            phase_time[nlohmann::json(static_cast<Phase>(phase_index)).get<std::string>()]
+                    = target.phase_time_[phase_index].count();
+        }
+        json_sys["phase_ns"] = phase_time;
+    }
+
+    Profiler::Profiler() : origin_(std::chrono::steady_clock::now()) {}
+
+    void Profiler::BeginCycle() {
+        // Add an empty cycle
+        cycles_.emplace_back();
+    }
+
+    const std::deque<Cycle>& Profiler::Cycles() const {
+        // Provide the cycles
+        return cycles_;
+    }
+
+    const std::vector<Span>& Profiler::Spans() const {
+        // Provide the Spans
+        return spans_;
+    }
+
+    utility::Counters Profiler::Totals() const {
+        // Add each cycle's counts together
+        utility::Counters totals;
+        for (const auto& current_cycle: cycles_) {
+            totals.Merge(current_cycle.counters_);
+        }
+        return totals;
+    }
+
+    nlohmann::json Profiler::TraceEvents() const {
+        // Find the extent of each cycle from its Phases
+        std::vector<std::pair<std::chrono::nanoseconds, std::chrono::nanoseconds>> cycle_extents(
+                cycles_.size(), {std::chrono::nanoseconds::max(), std::chrono::nanoseconds::zero()});
+        for (const auto& current_span: spans_) {
+            auto& extent = cycle_extents[current_span.cycle_];
+            extent.first = std::min(extent.first, current_span.start_);
+            extent.second = std::max(extent.second, current_span.start_ + current_span.duration_);
+        }
+
+        // Add a complete event for each cycle that has a measured Phase, in microseconds
+        auto events = nlohmann::json::array();
+        auto to_microseconds = [](std::chrono::nanoseconds time) {
+            return std::chrono::duration<double, std::micro>(time).count();
+        };
+        for (std::size_t cycle_index = 0; cycle_index < cycles_.size(); ++cycle_index) {
+            const auto& extent = cycle_extents[cycle_index];
+            if (extent.second < extent.first) {
+                continue;
+            }
+            events.push_back({{"name", "Cycle " + std::to_string(cycle_index)},
+                              {"cat", "cycle"},
+                              {"ph", "X"},
+                              {"ts", to_microseconds(extent.first)},
+                              {"dur", to_microseconds(extent.second - extent.first)},
+                              {"pid", 1},
+                              {"tid", 1},
+                              {"args", cycles_[cycle_index].counters_}});
+        }
+
+        // Add a complete event for each Phase, nested within its cycle
+        for (const auto& current_span: spans_) {
+            events.push_back({{"name", nlohmann::json(current_span.phase_)},
+                              {"cat", "phase"},
+                              {"ph", "X"},
+                              {"ts", to_microseconds(current_span.start_)},
+                              {"dur", to_microseconds(current_span.duration_)},
+                              {"pid", 1},
+                              {"tid", 1},
+                              {"args", {{"cycle", current_span.cycle_}}}});
+        }
+
+        // Wrap the events in the trace object
+        return {{"traceEvents", events}, {"displayTimeUnit", "ns"}};
+    }
+
+    void to_json(nlohmann::json& json_sys, const Profiler& target) {
+        // Export every cycle, and the totals
+        json_sys["cycles"] = nlohmann::json::array();
+        for (const auto& current_cycle: target.Cycles()) {
+            json_sys["cycles"].push_back(current_cycle);
+        }
+        json_sys["totals"] = target.Totals();
+    }
+
+    Measurement::Measurement(Profiler* profiler, Phase phase)
+        : profiler_(profiler), phase_(phase), start_(std::chrono::steady_clock::now()),
+          counter_scope_(CycleCounters(profiler)) {}
+
+    Measurement::~Measurement() {
+        // Catch if nothing is being measured
+        if (profiler_ == nullptr) {
+            return;
+        }
+
+        // Add the wall time to the current cycle
+        auto end = std::chrono::steady_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start_);
+        profiler_->cycles_.back().phase_time_[static_cast<std::size_t>(phase_)] += duration;
+
+        // Keep the Phase for the trace export
+        profiler_->spans_.push_back(Span{phase_,
+                                         profiler_->cycles_.size() - 1,
+                                         std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                 start_ - profiler_->origin_),
+                                         duration});
+    }
+
+    utility::Counters* Measurement::CycleCounters(Profiler* profiler) {
+        // Catch if nothing is being measured, leaving any active Counters in place
+        if (profiler == nullptr) {
+            return utility::CounterScope::Active();
+        }
+
+        // Start a cycle if there is none, and provide its Counters
+        if (profiler->cycles_.empty()) {
+            profiler->BeginCycle();
+        }
+        return &profiler->cycles_.back().counters_;
+    }
+
+} // namespace expert_system::engines::profiling
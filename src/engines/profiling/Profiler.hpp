@@ -0,0 +1,167 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "utility/Counters.hpp"
+
+namespace expert_system::engines::profiling {
+
+        /// The symbolic representations of the phases of a consultation's inference cycle.
+    enum class Phase {
+        kUnknown,
+        kMatch,
+        kFire,
+        kUserRequest,
+        kCount
+    };
+
+        /// JSON serialization for the Phase enum.
+    NLOHMANN_JSON_SERIALIZE_ENUM(Phase,
+                                {{Phase::kUnknown, nullptr},
+                                 {Phase::kMatch, "Match"},
+                                 {Phase::kFire, "Fire"},
+                                 {Phase::kUserRequest, "UserRequest"}})
+
+        /// The counts and wall time of a single inference cycle.
+    struct Cycle {
+            /// The events counted during the cycle's phases.
+        utility::Counters counters_;
+
+            /// The total wall time spent in each Phase, indexed by Phase.
+        std::array<std::chrono::nanoseconds, static_cast<std::size_t>(Phase::kCount)> phase_time_{};
+    };
+
+        /**
+         * @brief Cycle serialization to JSON format.
+         * @param [in,out] json_sys A reference to a JSON object.
+         * @param [in] target A reference to the Cycle to export.
+         * @note The wall times are exported in nanoseconds.
+         */
+    void to_json(nlohmann::json& json_sys, const Cycle& target);
+
+        /// A single measured Phase, kept for the trace export.
+    struct Span {
+            /// The measured Phase.
+        Phase phase_;
+
+            /// The index of the Cycle that the Phase belongs to.
+        std::size_t cycle_;
+
+            /// The time the Phase began, relative to the Profiler's construction.
+        std::chrono::nanoseconds start_;
+
+            /// The wall time of the Phase.
+        std::chrono::nanoseconds duration_;
+    };
+
+        /**
+         * @brief Gathers the counts and wall time of each inference cycle in a consultation.
+         * A consultation calls BeginCycle() at the start of each cycle, and measures each Phase with a Measurement.
+         * The counts are gathered from the Counters activated by each Measurement, see utility::CounterScope.
+         */
+    class Profiler {
+    public:
+            /// Default constructor, starts the Profiler's clock.
+        Profiler();
+
+            /// Starts a new inference cycle, subsequent Measurements are added to it.
+        void BeginCycle();
+
+            /**
+             * @brief Provides read access to the measured cycles.
+             * @return A const reference to the cycles, in the order they began.
+             */
+        [[nodiscard]] const std::deque<Cycle>& Cycles() const;
+
+            /**
+             * @brief Provides read access to the measured Phases.
+             * @return A const reference to the Spans, in the order they ended.
+             */
+        [[nodiscard]] const std::vector<Span>& Spans() const;
+
+            /**
+             * @brief Adds the counts of every cycle together.
+             * @return The total counts.
+             */
+        [[nodiscard]] utility::Counters Totals() const;
+
+            /**
+             * @brief Exports the measured Phases in the Chrome trace event format.
+             * Each cycle is a complete event containing its Phases, with the cycle's counts as its arguments.
+             * @return A JSON object that can be loaded by chrome://tracing or Perfetto.
+             */
+        [[nodiscard]] nlohmann::json TraceEvents() const;
+
+    private:
+        friend class Measurement;
+
+            /// The time the Profiler was constructed.
+        std::chrono::steady_clock::time_point origin_;
+
+            /// The measured cycles, which are not moved as more are added.
+        std::deque<Cycle> cycles_;
+
+            /// The measured Phases.
+        std::vector<Span> spans_;
+    };
+
+        /**
+         * @brief Profiler serialization to JSON format.
+         * @param [in,out] json_sys A reference to a JSON object.
+         * @param [in] target A reference to the Profiler to export.
+         */
+    void to_json(nlohmann::json& json_sys, const Profiler& target);
+
+        /**
+         * @brief Measures a Phase of the current cycle until the scope ends.
+         * Counts the events on the current thread in the cycle's Counters, and adds the wall time to the cycle.
+         * @note A Measurement without a Profiler does nothing, so that profiling can be optional.
+         * @warning BeginCycle() must not be called while a Measurement is in scope!
+         */
+    class Measurement {
+    public:
+            /**
+             * @brief Parameterized constructor, begins the measurement.
+             * @param [in] profiler The Profiler to add the measurement to, or nullptr to measure nothing.
+             * @param [in] phase The Phase being measured.
+             * @note A cycle is started if the Profiler has none.
+             */
+        Measurement(Profiler* profiler, Phase phase);
+
+            /// Destructor, ends the measurement.
+        ~Measurement();
+
+            /// Use of copy or assignment constructors is not allowed.
+        Measurement(const Measurement&) = delete;
+
+            /// Use of copy or assignment constructors is not allowed.
+        Measurement& operator=(const Measurement&) = delete;
+
+    private:
+            /**
+             * @brief Gathers the Counters of a Profiler's current cycle, starting a cycle if it has none.
+             * @param [in] profiler The target Profiler, or nullptr.
+             * @return A pointer to the Counters, or the already active Counters if there is no Profiler.
+             */
+        static utility::Counters* CycleCounters(Profiler* profiler);
+
+            /// The Profiler to add the measurement to.
+        Profiler* profiler_;
+
+            /// The Phase being measured.
+        Phase phase_;
+
+            /// The time the measurement began.
+        std::chrono::steady_clock::time_point start_;
+
+            /// Activates the cycle's Counters on the current thread.
+        utility::CounterScope counter_scope_;
+    };
+
+} // namespace expert_system::engines::profiling
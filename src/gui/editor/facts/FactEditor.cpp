@@ -83,6 +83,7 @@ void FactEditor::SaveFact() {
         error_indication.exec();
         return;
     }
+    auto fact_handle = database.Handle(selectedFact.value()).value();
 
     // Split the logic for each type of Fact
     switch (search_result.value().get().type_) {
@@ -116,7 +117,13 @@ void FactEditor::SaveFact() {
                     // Assign the new Range to the Fact
                     bool min_local = (ui.MinimumEditor->text().compare("True") == 0);
                     bool max_local = (ui.MaximumEditor->text().compare("True") == 0);
-                    raw_fact.SetRange(min_local, max_local, ui.InclusiveCheckbox->isChecked());
+                    if (!database.SetRange<bool>(fact_handle, min_local, max_local, ui.InclusiveCheckbox->isChecked())) {
+                        // Catch a session value that the new Range could invalidate
+                        QMessageBox error_indication;
+                        error_indication.setText("Error: cannot change the Range of a Fact with a session value!");
+                        error_indication.exec();
+                        break;
+                    }
                 }
             }
 
@@ -153,7 +160,13 @@ void FactEditor::SaveFact() {
                     // Assign the newRange to the Fact
                     int min_local = ui.MinimumEditor->text().toInt();
                     int max_local = ui.MaximumEditor->text().toInt();
-                    raw_fact.SetRange(min_local, max_local, ui.InclusiveCheckbox->isChecked());
+                    if (!database.SetRange<int>(fact_handle, min_local, max_local, ui.InclusiveCheckbox->isChecked())) {
+                        // Catch a session value that the new Range could invalidate
+                        QMessageBox error_indication;
+                        error_indication.setText("Error: cannot change the Range of a Fact with a session value!");
+                        error_indication.exec();
+                        break;
+                    }
                 }
             }
 
@@ -190,7 +203,13 @@ void FactEditor::SaveFact() {
                     // Assign the newRange to the Fact
                     float min_local = ui.MinimumEditor->text().toFloat();
                     float max_local = ui.MaximumEditor->text().toFloat();
-                    raw_fact.SetRange(min_local, max_local, ui.InclusiveCheckbox->isChecked());
+                    if (!database.SetRange<float>(fact_handle, min_local, max_local, ui.InclusiveCheckbox->isChecked())) {
+                        // Catch a session value that the new Range could invalidate
+                        QMessageBox error_indication;
+                        error_indication.setText("Error: cannot change the Range of a Fact with a session value!");
+                        error_indication.exec();
+                        break;
+                    }
                 }
             }
 
@@ -236,9 +255,16 @@ void FactEditor::SaveFact() {
                     }
 
                     // Assign the newRange to the Fact
-                    raw_fact.fact_.SetRange(raw_fact.enum_.At(min_local).value(),
-                                            raw_fact.enum_.At(max_local).value(),
-                                            ui.InclusiveCheckbox->isChecked());
+                    if (!database.SetRange<int>(fact_handle,
+                                                raw_fact.enum_.At(min_local).value(),
+                                                raw_fact.enum_.At(max_local).value(),
+                                                ui.InclusiveCheckbox->isChecked())) {
+                        // Catch a session value that the new Range could invalidate
+                        QMessageBox error_indication;
+                        error_indication.setText("Error: cannot change the Range of a Fact with a session value!");
+                        error_indication.exec();
+                        break;
+                    }
                 }
             }
 
@@ -627,10 +653,8 @@ void FactEditor::DeleteEnum() {
         return;
     }
 
-    // Update the Fact
-    auto& raw_fact = std::get<expert_system::knowledge::facts::EnumFact>(target_fact.value().get().fact_);
-    raw_fact.fact_.ClearRange();
-    raw_fact.enum_.Remove(selectedEnum.value());
+    // Update the Fact, keeping its session value and Range on the remaining enum values
+    database.RemoveEnumValue(selectedFact.value(), selectedEnum.value());
     UpdateFactEditors();
 }
 
@@ -46,7 +46,7 @@ void NewRule::CreateNewRule() {
     }
 
     // Generate the rule
-    database.managed_rules_.emplace(name_string, expert_system::knowledge::rules::Rule());
+    database.Insert(name_string, expert_system::knowledge::rules::Rule());
     auto& generated_rule = database.managed_rules_.at(name_string);
 
     // Split logic based on the select Fact's type
@@ -128,11 +128,12 @@ void NewRule::CreateNewRule() {
             error_indication.exec();
 
             // Delete the generated rule and allow the user to retry the dialog
-            database.managed_rules_.erase(name_string);
+            database.Remove(name_string);
             return;
         }
     }
 
-    // End the dialog
+    // Index the generated Rule's root Condition and end the dialog
+    database.Reindex(name_string);
     this->accept();
 }
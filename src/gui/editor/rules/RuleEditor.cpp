@@ -60,7 +60,7 @@ void RuleEditor::DeleteRule() {
 
     // Get the selected Rule's name and delete it
     auto& database = expert_system::utility::Singleton<expert_system::knowledge::rules::RuleDatabase>::Get();
-    database.managed_rules_.erase(current_rule_name_.value());
+    database.Remove(current_rule_name_.value());
     UpdateRuleEditor();
 }
 
@@ -85,6 +85,7 @@ void RuleEditor::NewCondition() {
     // Pass the Condition creation over to a new dialog
     class NewCondition condition_dialog(this, current_rule->second);
     condition_dialog.exec();
+    expert_system::utility::Singleton<expert_system::knowledge::rules::RuleDatabase>::Get().Reindex(current_rule_name_.value());
 
     // Remove the user's selection and update the editor
     current_condition_index_ = std::nullopt;
@@ -125,6 +126,7 @@ void RuleEditor::DeleteCondition() {
     auto condition_iterator = conditions.begin();
     std::advance(condition_iterator, current_condition_index_.value() - 1);
     conditions.erase(condition_iterator);
+    expert_system::utility::Singleton<expert_system::knowledge::rules::RuleDatabase>::Get().Reindex(current_rule_name_.value());
 
     // Remove the user's selection and update the editor
     current_condition_index_ = std::nullopt;
@@ -191,7 +193,7 @@ void RuleEditor::SaveCondition() {
                 raw_condition.confidence_factor_.Set((float) ui.MinimumConfidenceEditor->value());
 
                 // Get the target value
-                raw_condition.target_ = (QString("True").compare(ui.TargetEditor->text()) == 0);
+                raw_condition.SetTarget((QString("True").compare(ui.TargetEditor->text()) == 0));
 
                 // Finished
                 break;
@@ -237,7 +239,7 @@ void RuleEditor::SaveCondition() {
                 raw_condition.confidence_factor_.Set((float) ui.MinimumConfidenceEditor->value());
 
                 // Get the target value
-                raw_condition.target_ = ui.TargetEditor->text().toInt();
+                raw_condition.SetTarget(ui.TargetEditor->text().toInt());
 
                 // Finished
                 break;
@@ -283,7 +285,7 @@ void RuleEditor::SaveCondition() {
                 raw_condition.confidence_factor_.Set((float) ui.MinimumConfidenceEditor->value());
 
                 // Get the target value
-                raw_condition.target_ = ui.TargetEditor->text().toFloat();
+                raw_condition.SetTarget(ui.TargetEditor->text().toFloat());
 
                 // Finished
                 break;
@@ -329,7 +331,7 @@ void RuleEditor::SaveCondition() {
                 raw_condition.confidence_factor_.Set((float) ui.MinimumConfidenceEditor->value());
 
                 // Get the target value
-                raw_condition.target_ = ui.TargetEditor->text().toStdString();
+                raw_condition.SetTarget(ui.TargetEditor->text().toStdString());
 
                 // Finished
                 break;
@@ -370,7 +372,7 @@ void RuleEditor::SaveCondition() {
                 raw_condition.confidence_factor_.Set((float) ui.MinimumConfidenceEditor->value());
 
                 // Get the target value
-                raw_condition.target_ = (QString("True").compare(ui.TargetEditor->text()) == 0);
+                raw_condition.SetTarget((QString("True").compare(ui.TargetEditor->text()) == 0));
 
                 // Finished
                 break;
@@ -400,7 +402,7 @@ void RuleEditor::SaveCondition() {
                 raw_condition.confidence_factor_.Set((float) ui.MinimumConfidenceEditor->value());
 
                 // Get the target value
-                raw_condition.target_ = ui.TargetEditor->text().toInt();
+                raw_condition.SetTarget(ui.TargetEditor->text().toInt());
 
                 // Finished
                 break;
@@ -430,7 +432,7 @@ void RuleEditor::SaveCondition() {
                 raw_condition.confidence_factor_.Set((float) ui.MinimumConfidenceEditor->value());
 
                 // Get the target value
-                raw_condition.target_ = ui.TargetEditor->text().toFloat();
+                raw_condition.SetTarget(ui.TargetEditor->text().toFloat());
 
                 // Finished
                 break;
@@ -460,7 +462,7 @@ void RuleEditor::SaveCondition() {
                 raw_condition.confidence_factor_.Set((float) ui.MinimumConfidenceEditor->value());
 
                 // Get the target value
-                raw_condition.target_ = ui.TargetEditor->text().toStdString();
+                raw_condition.SetTarget(ui.TargetEditor->text().toStdString());
 
                 // Finished
                 break;
@@ -477,6 +479,9 @@ void RuleEditor::SaveCondition() {
         error_indication.exec();
         return;
     }
+
+    // Update the Rule's cached analysis of its edited Antecedent
+    rule_database.Reindex(current_rule_name_.value());
 }
 
 void RuleEditor::AssignmentSelected() {
@@ -500,6 +505,7 @@ void RuleEditor::NewAssignment() {
     // Pass the Condition creation over to a new dialog
     class NewAssignment assignment_dialog(this, current_rule->second);
     assignment_dialog.exec();
+    expert_system::utility::Singleton<expert_system::knowledge::rules::RuleDatabase>::Get().Reindex(current_rule_name_.value());
 
     // Remove the user's selection and update the editor
     current_response_index_ = std::nullopt;
@@ -531,6 +537,7 @@ void RuleEditor::DeleteAssignment() {
     auto assignment_iterator = assignments.begin();
     std::advance(assignment_iterator, current_response_index_.value());
     assignments.erase(assignment_iterator);
+    expert_system::utility::Singleton<expert_system::knowledge::rules::RuleDatabase>::Get().Reindex(current_rule_name_.value());
 
     // Remove the user's selection and update the editor
     current_response_index_ = std::nullopt;
@@ -553,7 +560,7 @@ void RuleEditor::SaveAssignment() {
             auto& raw_assignment = std::get<expert_system::knowledge::rules::BoolAssignment>(selected_assignment->assignment_);
 
             // Store the values
-            raw_assignment.value_ = (QString("True").compare(ui.ValueEditor->text()) == 0);
+            raw_assignment.SetValue((QString("True").compare(ui.ValueEditor->text()) == 0));
             raw_assignment.confidence_factor_.Set((float) ui.OutcomeConfidenceEditor->value());
             break;
         }
@@ -562,7 +569,7 @@ void RuleEditor::SaveAssignment() {
             auto& raw_assignment = std::get<expert_system::knowledge::rules::IntAssignment>(selected_assignment->assignment_);
 
             // Store the values
-            raw_assignment.value_ = ui.ValueEditor->text().toInt();
+            raw_assignment.SetValue(ui.ValueEditor->text().toInt());
             raw_assignment.confidence_factor_.Set((float) ui.OutcomeConfidenceEditor->value());
             break;
         }
@@ -571,7 +578,7 @@ void RuleEditor::SaveAssignment() {
             auto& raw_assignment = std::get<expert_system::knowledge::rules::FloatAssignment>(selected_assignment->assignment_);
 
             // Store the values
-            raw_assignment.value_ = ui.ValueEditor->text().toFloat();
+            raw_assignment.SetValue(ui.ValueEditor->text().toFloat());
             raw_assignment.confidence_factor_.Set((float) ui.OutcomeConfidenceEditor->value());
             break;
         }
@@ -580,7 +587,7 @@ void RuleEditor::SaveAssignment() {
             auto& raw_assignment = std::get<expert_system::knowledge::rules::EnumAssignment>(selected_assignment->assignment_);
 
             // Store the values
-            raw_assignment.value_ = ui.ValueEditor->text().toStdString();
+            raw_assignment.SetValue(ui.ValueEditor->text().toStdString());
             raw_assignment.confidence_factor_.Set((float) ui.OutcomeConfidenceEditor->value());
             break;
         }
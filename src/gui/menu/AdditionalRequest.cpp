@@ -7,8 +7,8 @@
 
 AdditionalRequest::AdditionalRequest(
         const std::set<std::string>& requested_facts,
-        std::vector<std::vector<expert_system::engines::explanation::Log>>& existing_log,
-        QWidget *parent) : QDialog(parent), existing_log_(existing_log) {
+        expert_system::engines::explanation::TraceStore& existing_trace,
+        QWidget *parent) : QDialog(parent), existing_trace_(existing_trace) {
     // Ensure that the UI is configured
     ui.setupUi(this);
 
@@ -37,6 +37,7 @@ void AdditionalRequest::SaveAndContinue() {
     // Get the selected Fact
     auto& database = expert_system::utility::Singleton<expert_system::knowledge::facts::FactDatabase>::Get();
     auto search_result = database.Find(selected_fact_);
+    auto fact_handle = database.Handle(selected_fact_).value_or(expert_system::knowledge::facts::kInvalidFactHandle);
 
     // Catch if the gathered fact is invalid
     if (search_result == std::nullopt) {
@@ -47,9 +48,6 @@ void AdditionalRequest::SaveAndContinue() {
     // Split the logic for the type of fact
     switch (search_result.value().get().type_) {
         case expert_system::utility::ExpertSystemTypes::kBool: {
-            // Get a reference to the raw Fact
-            auto& raw_fact = std::get<expert_system::knowledge::facts::BoolFact>(search_result.value().get().fact_);
-
             // Get the user-provided value
             auto gathered_value = (ui.ValueEditor->text().compare("True") == 0);
 
@@ -57,7 +55,7 @@ void AdditionalRequest::SaveAndContinue() {
             expert_system::utility::Confidence gathered_confidence((float) ui.ConfidenceEditor->value());
 
             // Attempt to store the data provided in the editor
-            if (!raw_fact.SetValue(gathered_value, gathered_confidence)) {
+            if (!database.SetValue(fact_handle, gathered_value, gathered_confidence)) {
                 // Report the error to the user and stop attempting to save the data
                 QMessageBox error_indication;
                 error_indication.setText("Error: the provided value is outside of the Fact's range!");
@@ -66,15 +64,12 @@ void AdditionalRequest::SaveAndContinue() {
             }
 
             // Log the user's assignment of the Fact's value
-            std::vector<expert_system::engines::explanation::Log> this_assignment_log;
-            this_assignment_log.push_back(expert_system::engines::inference::forward::LogSpecific(selected_fact_, database).value());
-            existing_log_.get().push_back(this_assignment_log);
+            existing_trace_.get().BeginStep();
+            existing_trace_.get().BeginEvent(std::nullopt);
+            existing_trace_.get().Record(selected_fact_, database);
             break;
         }
         case expert_system::utility::ExpertSystemTypes::kInt: {
-            // Get a reference to the raw Fact
-            auto& raw_fact = std::get<expert_system::knowledge::facts::IntFact>(search_result.value().get().fact_);
-
             // Get the user-provided value
             auto gathered_value = ui.ValueEditor->text().toInt();
 
@@ -82,7 +77,7 @@ void AdditionalRequest::SaveAndContinue() {
             expert_system::utility::Confidence gathered_confidence((float) ui.ConfidenceEditor->value());
 
             // Attempt to store the data provided in the editor
-            if (!raw_fact.SetValue(gathered_value, gathered_confidence)) {
+            if (!database.SetValue(fact_handle, gathered_value, gathered_confidence)) {
                 // Report the error to the user and stop attempting to save the data
                 QMessageBox error_indication;
                 error_indication.setText("Error: the provided value is outside of the Fact's range!");
@@ -91,15 +86,12 @@ void AdditionalRequest::SaveAndContinue() {
             }
 
             // Log the user's assignment of the Fact's value
-            std::vector<expert_system::engines::explanation::Log> this_assignment_log;
-            this_assignment_log.push_back(expert_system::engines::inference::forward::LogSpecific(selected_fact_, database).value());
-            existing_log_.get().push_back(this_assignment_log);
+            existing_trace_.get().BeginStep();
+            existing_trace_.get().BeginEvent(std::nullopt);
+            existing_trace_.get().Record(selected_fact_, database);
             break;
         }
         case expert_system::utility::ExpertSystemTypes::kFloat: {
-            // Get a reference to the raw Fact
-            auto& raw_fact = std::get<expert_system::knowledge::facts::FloatFact>(search_result.value().get().fact_);
-
             // Get the user-provided value
             auto gathered_value = ui.ValueEditor->text().toFloat();
 
@@ -107,7 +99,7 @@ void AdditionalRequest::SaveAndContinue() {
             expert_system::utility::Confidence gathered_confidence((float) ui.ConfidenceEditor->value());
 
             // Attempt to store the data provided in the editor
-            if (!raw_fact.SetValue(gathered_value, gathered_confidence)) {
+            if (!database.SetValue(fact_handle, gathered_value, gathered_confidence)) {
                 // Report the error to the user and stop attempting to save the data
                 QMessageBox error_indication;
                 error_indication.setText("Error: the provided value is outside of the Fact's range!");
@@ -116,9 +108,9 @@ void AdditionalRequest::SaveAndContinue() {
             }
 
             // Log the user's assignment of the Fact's value
-            std::vector<expert_system::engines::explanation::Log> this_assignment_log;
-            this_assignment_log.push_back(expert_system::engines::inference::forward::LogSpecific(selected_fact_, database).value());
-            existing_log_.get().push_back(this_assignment_log);
+            existing_trace_.get().BeginStep();
+            existing_trace_.get().BeginEvent(std::nullopt);
+            existing_trace_.get().Record(selected_fact_, database);
             break;
         }
         case expert_system::utility::ExpertSystemTypes::kEnum: {
@@ -139,7 +131,7 @@ void AdditionalRequest::SaveAndContinue() {
             expert_system::utility::Confidence gathered_confidence((float) ui.ConfidenceEditor->value());
 
             // Attempt to store the data provided in the editor
-            if (!raw_fact.fact_.SetValue(gathered_value.value(), gathered_confidence)) {
+            if (!database.SetValue(fact_handle, gathered_value.value(), gathered_confidence)) {
                 // Report the error to the user and stop attempting to save the data
                 QMessageBox error_indication;
                 error_indication.setText("Error: the provided value is outside of the Fact's range!");
@@ -148,9 +140,9 @@ void AdditionalRequest::SaveAndContinue() {
             }
 
             // Log the user's assignment of the Fact's value
-            std::vector<expert_system::engines::explanation::Log> this_assignment_log;
-            this_assignment_log.push_back(expert_system::engines::inference::forward::LogSpecific(selected_fact_, database).value());
-            existing_log_.get().push_back(this_assignment_log);
+            existing_trace_.get().BeginStep();
+            existing_trace_.get().BeginEvent(std::nullopt);
+            existing_trace_.get().Record(selected_fact_, database);
             break;
         }
         default: {
@@ -4,7 +4,7 @@
 
 #include <QDialog>
 
-#include "engines/explanation/Log.hpp"
+#include "engines/explanation/TraceStore.hpp"
 
 #include "ui_AdditionalRequest.h"
 
@@ -19,7 +19,7 @@ public:
         /// Inherited Qt5 constructor.
     explicit AdditionalRequest(
             const std::set<std::string>& requested_facts,
-            std::vector<std::vector<expert_system::engines::explanation::Log>>& existing_log,
+            expert_system::engines::explanation::TraceStore& existing_trace,
             QWidget *parent = nullptr);
 
 private slots:
@@ -33,8 +33,8 @@ private:
         /// Updates the contents of the editor and enables its interacivity.
     void UpdateEditor();
 
-        /// Stores a reference to an existing log to output the events of this dialog into
-    std::reference_wrapper<std::vector<std::vector<expert_system::engines::explanation::Log>>> existing_log_;
+        /// Stores a reference to an existing trace to record the events of this dialog into
+    std::reference_wrapper<expert_system::engines::explanation::TraceStore> existing_trace_;
 
         /// Keeps track of the name of the selected Fact.
     std::string selected_fact_;
@@ -35,6 +35,7 @@ void ConsultationBegin::SaveFactValue() {
     // Get the selected Fact
     auto& database = expert_system::utility::Singleton<expert_system::knowledge::facts::FactDatabase>::Get();
     auto search_result = database.Find(selected_fact_.value());
+    auto fact_handle = database.Handle(selected_fact_.value()).value_or(expert_system::knowledge::facts::kInvalidFactHandle);
 
     // Catch if the gathered fact is invalid
     if (search_result == std::nullopt) {
@@ -45,9 +46,6 @@ void ConsultationBegin::SaveFactValue() {
     // Split the logic for the type of fact
     switch (search_result.value().get().type_) {
         case expert_system::utility::ExpertSystemTypes::kBool: {
-            // Get a reference to the raw Fact
-            auto& raw_fact = std::get<expert_system::knowledge::facts::BoolFact>(search_result.value().get().fact_);
-
             // Get the user-provided value
             auto gathered_value = (ui.ValueEditor->text().compare("True") == 0);
 
@@ -55,7 +53,7 @@ void ConsultationBegin::SaveFactValue() {
             expert_system::utility::Confidence gathered_confidence((float) ui.ConfidenceEditor->value());
 
             // Attempt to store the data provided in the editor
-            if (!raw_fact.SetValue(gathered_value, gathered_confidence)) {
+            if (!database.SetValue(fact_handle, gathered_value, gathered_confidence)) {
                 // Report the error to the user and stop attempting to save the data
                 QMessageBox error_indication;
                 error_indication.setText("Error: cannot save the invalid value provided!");
@@ -66,9 +64,6 @@ void ConsultationBegin::SaveFactValue() {
             break;
         }
         case expert_system::utility::ExpertSystemTypes::kInt: {
-            // Get a reference to the raw Fact
-            auto& raw_fact = std::get<expert_system::knowledge::facts::IntFact>(search_result.value().get().fact_);
-
             // Get the user-provided value
             auto gathered_value = ui.ValueEditor->text().toInt();
 
@@ -76,7 +71,7 @@ void ConsultationBegin::SaveFactValue() {
             expert_system::utility::Confidence gathered_confidence((float) ui.ConfidenceEditor->value());
 
             // Attempt to store the data provided in the editor
-            if (!raw_fact.SetValue(gathered_value, gathered_confidence)) {
+            if (!database.SetValue(fact_handle, gathered_value, gathered_confidence)) {
                 // Report the error to the user and stop attempting to save the data
                 QMessageBox error_indication;
                 error_indication.setText("Error: cannot save the invalid value provided!");
@@ -87,9 +82,6 @@ void ConsultationBegin::SaveFactValue() {
             break;
         }
         case expert_system::utility::ExpertSystemTypes::kFloat: {
-            // Get a reference to the raw Fact
-            auto& raw_fact = std::get<expert_system::knowledge::facts::FloatFact>(search_result.value().get().fact_);
-
             // Get the user-provided value
             auto gathered_value = ui.ValueEditor->text().toFloat();
 
@@ -97,7 +89,7 @@ void ConsultationBegin::SaveFactValue() {
             expert_system::utility::Confidence gathered_confidence((float) ui.ConfidenceEditor->value());
 
             // Attempt to store the data provided in the editor
-            if (!raw_fact.SetValue(gathered_value, gathered_confidence)) {
+            if (!database.SetValue(fact_handle, gathered_value, gathered_confidence)) {
                 // Report the error to the user and stop attempting to save the data
                 QMessageBox error_indication;
                 error_indication.setText("Error: cannot save the invalid value provided!");
@@ -125,7 +117,7 @@ void ConsultationBegin::SaveFactValue() {
             expert_system::utility::Confidence gathered_confidence((float) ui.ConfidenceEditor->value());
 
             // Attempt to store the data provided in the editor
-            if (!raw_fact.fact_.SetValue(gathered_value.value(), gathered_confidence)) {
+            if (!database.SetValue(fact_handle, gathered_value.value(), gathered_confidence)) {
                 // Report the error to the user and stop attempting to save the data
                 QMessageBox error_indication;
                 error_indication.setText("Error: cannot save the invalid value provided!");
@@ -167,6 +159,7 @@ void ConsultationBegin::UpdateEditor() {
     // Attempt to gather the Fact
     auto& database = expert_system::utility::Singleton<expert_system::knowledge::facts::FactDatabase>::Get();
     auto search_result = database.Find(selected_fact_.value());
+    auto fact_handle = database.Handle(selected_fact_.value()).value_or(expert_system::knowledge::facts::kInvalidFactHandle);
     if (search_result == std::nullopt) {
         // Simply stop
         return;
@@ -176,8 +169,7 @@ void ConsultationBegin::UpdateEditor() {
     auto& fact_reference = search_result.value().get();
     switch (fact_reference.type_) {
         case expert_system::utility::ExpertSystemTypes::kBool: {
-            // Track the raw Fact
-            auto& fact_raw = std::get<expert_system::knowledge::facts::BoolFact>(fact_reference.fact_);
+            // Indicate the Fact's type
             ui.TypeIndicator->setText("Boolean");
 
             // Configure the Value editor's validator
@@ -185,7 +177,7 @@ void ConsultationBegin::UpdateEditor() {
             ui.ValueEditor->setValidator(new QRegExpValidator(boolExpr, this));
 
             // Gather and present the Fact's session value data if it has one
-            auto existing_fact_value = fact_raw.GetValue();
+            auto existing_fact_value = database.GetValue<bool>(fact_handle);
             if (existing_fact_value.has_value()) {
                 // Present the raw value
                 if (existing_fact_value.value().value_) {
@@ -203,8 +195,7 @@ void ConsultationBegin::UpdateEditor() {
             break;
         }
         case expert_system::utility::ExpertSystemTypes::kInt: {
-            // Track the raw Fact and indicate its type
-            auto& fact_raw = std::get<expert_system::knowledge::facts::IntFact>(fact_reference.fact_);
+            // Indicate the Fact's type
             ui.TypeIndicator->setText("Integer");
 
             // Configure the Value editor's validator
@@ -213,7 +204,7 @@ void ConsultationBegin::UpdateEditor() {
                                                            this));
 
             // Gather and present the Fact's session value data if it has one
-            auto existing_fact_value = fact_raw.GetValue();
+            auto existing_fact_value = database.GetValue<int>(fact_handle);
             if (existing_fact_value.has_value()) {
                 // Present the raw value
                 ui.ValueEditor->setText(QString::number(existing_fact_value.value().value_));
@@ -227,8 +218,7 @@ void ConsultationBegin::UpdateEditor() {
             break;
         }
         case expert_system::utility::ExpertSystemTypes::kFloat: {
-            // Track the raw Fact and indicate its type
-            auto& fact_raw = std::get<expert_system::knowledge::facts::FloatFact>(fact_reference.fact_);
+            // Indicate the Fact's type
             ui.TypeIndicator->setText("Float");
 
             // Configure the Value editor's validator
@@ -237,7 +227,7 @@ void ConsultationBegin::UpdateEditor() {
                                                               std::numeric_limits<float>::digits, this));
 
             // Gather and present the Fact's session value data if it has one
-            auto existing_fact_value = fact_raw.GetValue();
+            auto existing_fact_value = database.GetValue<float>(fact_handle);
             if (existing_fact_value.has_value()) {
                 // Present the raw value
                 ui.ValueEditor->setText(QString::number(existing_fact_value.value().value_));
@@ -274,7 +264,7 @@ void ConsultationBegin::UpdateEditor() {
             ui.ValueEditor->setValidator(new QRegExpValidator(enumExpr, this));
 
             // Gather and present the Fact's session value data if it has one
-            auto existing_fact_value = fact_raw.fact_.GetValue();
+            auto existing_fact_value = database.GetValue<int>(fact_handle);
             if (existing_fact_value.has_value()) {
                 // Present the raw value
                 ui.ValueEditor->setText(fact_raw.enum_.At(existing_fact_value.value().value_).value().c_str());
@@ -7,13 +7,14 @@
 #include "utility/Singleton.hpp"
 
 ConsultationResult::ConsultationResult(
-        std::vector<std::vector<expert_system::engines::explanation::Log>> &logs,
+        const expert_system::engines::explanation::TraceStore& trace,
         QWidget *parent) : QDialog(parent) {
     // Ensure that the UI is configured
     ui.setupUi(this);
 
     // Fill the Fact list
-    auto fact_names = expert_system::utility::Singleton<expert_system::knowledge::facts::FactDatabase>::Get().List();
+    auto& fact_database = expert_system::utility::Singleton<expert_system::knowledge::facts::FactDatabase>::Get();
+    auto fact_names = fact_database.List();
     for (auto& current_name: fact_names) {
         // Add the Fact name to the list
         new QListWidgetItem(current_name.c_str(), ui.FactList);
@@ -21,8 +22,9 @@ ConsultationResult::ConsultationResult(
 
     // Iterate through each step in the process tree
     int step_counter = 1;
-    for (auto& current_step: logs) {
-        // Catch if the current step is empty
+    for (std::size_t step_index = 0; step_index < trace.StepCount(); ++step_index) {
+        // Rebuild the step's logs from the trace, and catch if the step is empty
+        auto current_step = trace.Logs(step_index, fact_database);
         if (current_step.empty()) {
             // Move onto the next step
             continue;
@@ -146,6 +148,7 @@ void ConsultationResult::FactSelected() {
     // Attempt to gather the selected Fact
     auto& database = expert_system::utility::Singleton<expert_system::knowledge::facts::FactDatabase>::Get();
     auto search_result = database.Find(ui.FactList->currentItem()->text().toStdString());
+    auto fact_handle = database.Handle(ui.FactList->currentItem()->text().toStdString()).value_or(expert_system::knowledge::facts::kInvalidFactHandle);
     if (search_result == std::nullopt) {
         // Just indicate the error
         ui.FactValue->setText("Error");
@@ -156,11 +159,8 @@ void ConsultationResult::FactSelected() {
     auto& fact_reference = search_result.value().get();
     switch (fact_reference.type_) {
         case expert_system::utility::ExpertSystemTypes::kBool: {
-            // Track the raw Fact
-            auto& fact_raw = std::get<expert_system::knowledge::facts::BoolFact>(fact_reference.fact_);
-
             // Gather and present the Fact's session value data if it has one
-            auto fact_value = fact_raw.GetValue();
+            auto fact_value = database.GetValue<bool>(fact_handle);
             if (fact_value.has_value()) {
                 // Present the raw value
                 if (fact_value.value().value_) {
@@ -180,11 +180,8 @@ void ConsultationResult::FactSelected() {
             break;
         }
         case expert_system::utility::ExpertSystemTypes::kInt: {
-            // Track the raw Fact
-            auto& fact_raw = std::get<expert_system::knowledge::facts::IntFact>(fact_reference.fact_);
-
             // Gather and present the Fact's session value data if it has one
-            auto fact_value = fact_raw.GetValue();
+            auto fact_value = database.GetValue<int>(fact_handle);
             if (fact_value.has_value()) {
                 // Present the raw value
                 ui.FactValue->setText(QString::number(fact_value.value().value_));
@@ -200,11 +197,8 @@ void ConsultationResult::FactSelected() {
             break;
         }
         case expert_system::utility::ExpertSystemTypes::kFloat: {
-            // Track the raw Fact
-            auto& fact_raw = std::get<expert_system::knowledge::facts::FloatFact>(fact_reference.fact_);
-
             // Gather and present the Fact's session value data if it has one
-            auto fact_value = fact_raw.GetValue();
+            auto fact_value = database.GetValue<float>(fact_handle);
             if (fact_value.has_value()) {
                 // Present the raw value
                 ui.FactValue->setText(QString::number(fact_value.value().value_));
@@ -224,7 +218,7 @@ void ConsultationResult::FactSelected() {
             auto& fact_raw = std::get<expert_system::knowledge::facts::EnumFact>(fact_reference.fact_);
 
             // Gather and present the Fact's session value data if it has one
-            auto fact_value = fact_raw.fact_.GetValue();
+            auto fact_value = database.GetValue<int>(fact_handle);
             if (fact_value.has_value()) {
                 // Present the raw value
                 ui.FactValue->setText(fact_raw.enum_.At(fact_value.value().value_).value().c_str());
@@ -4,7 +4,7 @@
 
 #include <QDialog>
 
-#include "engines/explanation/Log.hpp"
+#include "engines/explanation/TraceStore.hpp"
 
 #include "ui_ConsultationResult.h"
 
@@ -17,7 +17,7 @@ class ConsultationResult : public QDialog {
 
 public:
         /// Inherited Qt5 constructor.
-    explicit ConsultationResult(std::vector<std::vector<expert_system::engines::explanation::Log>>& logs,
+    explicit ConsultationResult(const expert_system::engines::explanation::TraceStore& trace,
                                 QWidget *parent = nullptr);
 
 private slots:
@@ -1,20 +1,31 @@
 #include "MainMenu.h"
 
+#include <cstdlib>
 #include <fstream>
 #include <iomanip>
+#include <optional>
+#include <string>
 
 #include <QFileDialog>
+#include <QInputDialog>
 #include <QMessageBox>
 #include <QString>
+#include <QStringList>
 
 #include "nlohmann/json.hpp"
 
+#include "engines/explanation/NdjsonSink.hpp"
+#include "engines/inference/Backward.hpp"
 #include "engines/inference/Forward.hpp"
+#include "engines/inference/MatchNetwork.hpp"
+#include "engines/profiling/Profiler.hpp"
 #include "gui/editor/facts/FactEditor.h"
 #include "gui/editor/rules/RuleEditor.h"
 #include "gui/menu/ConsultationBegin.h"
 #include "gui/menu/ConsultationResult.h"
 #include "gui/menu/AdditionalRequest.h"
+#include "knowledge/BinaryFormat.hpp"
+#include "knowledge/StreamLoader.hpp"
 #include "knowledge/facts/FactDatabase.hpp"
 #include "knowledge/rules/RuleDatabase.hpp"
 #include "utility/Singleton.hpp"
@@ -31,12 +42,27 @@ void MainMenu::SaveExpertSystem() {
             this,
             "Save Expert System",
             "./",
-            "Expert System JSON (*.json);;All files (*)");
+            "Expert System JSON (*.json);;Expert System Binary (*.eskb);;All files (*)");
     if (file_name.isEmpty()) {
         // Catch the invalid file name and stop
         return;
     }
 
+    // Catch a request for the binary format
+    if (file_name.endsWith(".eskb", Qt::CaseInsensitive)) {
+        // Attempt to encode the databases into the file
+        if (!expert_system::knowledge::binary::Save(
+                file_name.toStdString(),
+                expert_system::utility::Singleton<expert_system::knowledge::facts::FactDatabase>::Get(),
+                expert_system::utility::Singleton<expert_system::knowledge::rules::RuleDatabase>::Get())) {
+            // Catch the error and indicate failure
+            QMessageBox error_indication;
+            error_indication.setText("Unable to write file \"" + file_name + "\"");
+            error_indication.exec();
+        }
+        return;
+    }
+
     // Attempt to open the requested file
     std::ofstream file_stream(file_name.toStdString(),
                               std::ofstream::out | std::ofstream::ate);
@@ -66,50 +92,42 @@ void MainMenu::LoadExpertSystem() {
             this,
             "Load Expert System",
             "./",
-            "Expert System JSON (*.json);;All files (*)");
+            "Expert System JSON (*.json);;Expert System Binary (*.eskb);;All files (*)");
     if (file_name.isEmpty()) {
         // Catch the invalid file name and stop
         return;
     }
 
-    // Attempt to open the requested file
-    std::ifstream file_stream(file_name.toStdString(), std::ifstream::in);
-    if (!file_stream.is_open()) {
-        // Catch the error and indicate failure
-        QMessageBox error_indication;
-        error_indication.setText("Unable to open file \"" + file_name + "\"");
-        error_indication.exec();
+    // Catch a binary knowledge base, which is mapped and decoded in place
+    if (expert_system::knowledge::binary::IsBinaryFile(file_name.toStdString())) {
+        // Attempt to decode the databases, which are only replaced on success
+        auto outcome = expert_system::knowledge::binary::Load(
+                file_name.toStdString(),
+                expert_system::utility::Singleton<expert_system::knowledge::facts::FactDatabase>::Get(),
+                expert_system::utility::Singleton<expert_system::knowledge::rules::RuleDatabase>::Get());
+        if (outcome != expert_system::knowledge::binary::BinaryOutcome::kSuccess) {
+            // Catch the error and indicate failure
+            QMessageBox error_indication;
+            error_indication.setText("Could not load the binary knowledge base from \"" + file_name + "\": "
+                                     + QString::fromStdString(nlohmann::json(outcome).get<std::string>()));
+            error_indication.exec();
+        }
         return;
     }
 
-    // Parse the file data into a JSON object
-    nlohmann::json json_store;
-    file_stream >> json_store;
-    file_stream.close();
-
-    // Catch not all data being loaded
-    if (json_store.find(expert_system::utility::JSON_ID_DATABASE_FACTS) == json_store.end()) {
-        // Catch the error and indicate failure
-        QMessageBox error_indication;
-        error_indication.setText("Could not load the Fact Database from \"" + file_name + "\"");
-        error_indication.exec();
-        return;
-    }
-    if (json_store.find(expert_system::utility::JSON_ID_DATABASE_RULES) == json_store.end()) {
+    // Stream the JSON format into the databases, which are only replaced on success
+    expert_system::knowledge::stream::LoadError error;
+    if (!expert_system::knowledge::stream::Load(
+            file_name.toStdString(),
+            expert_system::utility::Singleton<expert_system::knowledge::facts::FactDatabase>::Get(),
+            expert_system::utility::Singleton<expert_system::knowledge::rules::RuleDatabase>::Get(),
+            error)) {
         // Catch the error and indicate failure
         QMessageBox error_indication;
-        error_indication.setText("Could not load the Rule Database from \"" + file_name + "\"");
+        error_indication.setText("Could not load the expert system from \"" + file_name + "\": "
+                                 + QString::fromStdString(error.Describe()));
         error_indication.exec();
-        return;
     }
-
-    // Parse and store the databases
-    expert_system::utility::Singleton<expert_system::knowledge::facts::FactDatabase>::Get()
-        = json_store.at(expert_system::utility::JSON_ID_DATABASE_FACTS)
-                    .get<expert_system::knowledge::facts::FactDatabase>();
-    expert_system::utility::Singleton<expert_system::knowledge::rules::RuleDatabase>::Get()
-        = json_store.at(expert_system::utility::JSON_ID_DATABASE_RULES)
-                    .get<expert_system::knowledge::rules::RuleDatabase>();
 }
 
 void MainMenu::RulesDomainKnowledge() {
@@ -148,51 +166,93 @@ void MainMenu::ForwardInferrencingConsult() {
     }
 
     // Keep track of the events that occur while inferring
-    std::vector<std::vector<expert_system::engines::explanation::Log>> logged_events;
+    expert_system::engines::explanation::TraceStore trace(rule_database);
+
+    // Also stream the events to a file, if requested through the environment
+    std::optional<expert_system::engines::explanation::NdjsonSink> events_sink;
+    auto events_file = std::getenv("ESS_EVENTS");
+    if (events_file != nullptr) {
+        events_sink.emplace(std::string(events_file));
+    }
 
     // Begin the consultation by gathering a set of existing values from the user
     ConsultationBegin initial_dialog(this);
     initial_dialog.exec();
-    std::vector<expert_system::engines::explanation::Log> initial_user_input_log;
-    initial_user_input_log.push_back(expert_system::engines::inference::forward::LogExisting(fact_database));
-    logged_events.push_back(initial_user_input_log);
+    std::vector<expert_system::engines::explanation::Log> existing_logs{
+            expert_system::engines::inference::forward::LogExisting(fact_database)};
+    trace.Write(existing_logs, fact_database);
+    if (events_sink.has_value()) {
+        events_sink->Write(existing_logs, fact_database);
+    }
+
+    // Measure the consultation only if a trace file was requested through the environment
+    expert_system::engines::profiling::Profiler profiler;
+    auto trace_file = std::getenv("ESS_TRACE");
+    auto active_profiler = (trace_file != nullptr) ? &profiler : nullptr;
+
+    // Compile the Rules into a match network and test them against the initial values
+    expert_system::engines::inference::MatchNetwork match_network(rule_database);
+    {
+        expert_system::engines::profiling::Measurement measurement(active_profiler,
+                                                                    expert_system::engines::profiling::Phase::kMatch);
+        match_network.Synchronize(fact_database);
+    }
 
     // Continue to loop through the inference process
     while (true) {
         // Catch if any facts do not have a session value
-        if (fact_database.List(expert_system::knowledge::facts::FactFilter::kHasNoValue).empty()) {
+        if (!fact_database.AnyUnknown()) {
             // Stop the consultation and show the results
             break;
         }
 
         // Catch if any rules have not yet been triggered
-        if (rule_database.ListRules(expert_system::knowledge::rules::RuleFilter::kHasNotRunConsequent).empty()) {
+        if (!match_network.AnyNotRun()) {
             // Stop the consultation and show the results
             break;
         }
 
         // Find the triggered Rules
-        auto trigger_list = expert_system::engines::inference::forward::FindTriggered(
-                fact_database,
-                rule_database);
+        std::list<std::map<std::string, expert_system::knowledge::rules::Rule>::iterator> trigger_list;
+        {
+            expert_system::engines::profiling::Measurement measurement(active_profiler,
+                                                                        expert_system::engines::profiling::Phase::kMatch);
+            trigger_list = expert_system::engines::inference::forward::FindTriggered(match_network);
+        }
 
         // Catch if any rules were actually triggered
         if (!trigger_list.empty()) {
             // Run the triggered Rule's Consequents and log the outcomes
-            logged_events.push_back(expert_system::engines::inference::forward::RunTriggered(
+            expert_system::engines::profiling::Measurement measurement(active_profiler,
+                                                                        expert_system::engines::profiling::Phase::kFire);
+            auto triggered_logs = expert_system::engines::inference::forward::RunTriggered(
                     trigger_list,
-                    fact_database));
+                    fact_database,
+                    match_network);
+            trace.Write(triggered_logs, fact_database);
+            if (events_sink.has_value()) {
+                events_sink->Write(triggered_logs, fact_database);
+            }
         }
         else {
+            // Measure the time spent waiting for the user
+            expert_system::engines::profiling::Measurement measurement(active_profiler,
+                                                                        expert_system::engines::profiling::Phase::kUserRequest);
+
             // Identify the Fact session values needed to trigger the remaining rules
             auto needed_fact_values =
                     expert_system::engines::inference::forward::IdentifyFactRequests(
                             fact_database,
                             rule_database);
 
+            // Write out the streamed events, as no more arrive while waiting for the user
+            if (events_sink.has_value()) {
+                events_sink->Flush();
+            }
+
             // Generate a dialog to request one of these missing fact session values
             AdditionalRequest request_dialog(needed_fact_values,
-                                             logged_events,
+                                             trace,
                                              this);
 
             // Catch if the user wanted to finish the consultation
@@ -200,11 +260,38 @@ void MainMenu::ForwardInferrencingConsult() {
                 // Stop the consultation and show the results
                 break;
             }
+
+            // Propagate the user's new session value through the match network
+            auto requested_logs = trace.Logs(trace.StepCount() - 1, fact_database);
+            for (auto& current_log: requested_logs) {
+                for (auto& current_assignment: current_log.assignments_) {
+                    match_network.Update(current_assignment.first, fact_database);
+                }
+            }
+            if (events_sink.has_value()) {
+                events_sink->Write(requested_logs, fact_database);
+            }
+        }
+
+        // Start measuring the next cycle
+        if (active_profiler != nullptr) {
+            active_profiler->BeginCycle();
         }
     }
 
+    // Write out the streamed events before presenting them
+    if (events_sink.has_value()) {
+        events_sink->Flush();
+    }
+
+    // Export the trace, if requested
+    if (trace_file != nullptr) {
+        std::ofstream trace_stream(trace_file, std::ofstream::out);
+        trace_stream << profiler.TraceEvents() << std::endl;
+    }
+
     // Display the consultation results
-    ConsultationResult result_dialog(logged_events, this);
+    ConsultationResult result_dialog(trace, this);
     result_dialog.exec();
 
     // Make sure to clean up before finishing
@@ -213,8 +300,89 @@ void MainMenu::ForwardInferrencingConsult() {
 }
 
 void MainMenu::BackwardInferrencingConsult() {
-    // Indicate this is currently not supported
-    QMessageBox error_indication;
-    error_indication.setText("Backwards Inferencing is currently not supported.");
-    error_indication.exec();
+    // Keep track of the two databases
+    auto& fact_database = expert_system::utility::Singleton<expert_system::knowledge::facts::FactDatabase>::Get();
+    auto& rule_database = expert_system::utility::Singleton<expert_system::knowledge::rules::RuleDatabase>::Get();
+
+    // Prevent this from being run if there are not stored Facts and Rules to inference
+    if ((fact_database.Count() <= 0) || (rule_database.managed_rules_.empty())) {
+        QMessageBox error_indication;
+        error_indication.setText("A consultation cannot begin if no Facts or Rules exist!");
+        error_indication.exec();
+        return;
+    }
+
+    // List the Facts that can be concluded by a Rule
+    QStringList goal_options;
+    for (auto& current_fact_name: fact_database.List()) {
+        if (!rule_database.ListFactWriters(current_fact_name).empty()) {
+            goal_options.append(current_fact_name.c_str());
+        }
+    }
+    if (goal_options.empty()) {
+        QMessageBox error_indication;
+        error_indication.setText("A consultation cannot begin if no Rules assign a Fact!");
+        error_indication.exec();
+        return;
+    }
+
+    // Ask the user which Fact the consultation should conclude
+    bool goal_selected = false;
+    auto goal_fact = QInputDialog::getItem(this,
+                                           "Backward Chaining Consultation",
+                                           "Goal Fact:",
+                                           goal_options,
+                                           0,
+                                           false,
+                                           &goal_selected).toStdString();
+    if (!goal_selected) {
+        // Catch the cancelled selection and stop
+        return;
+    }
+
+    // Keep track of the events that occur while inferring
+    expert_system::engines::explanation::TraceStore trace(rule_database);
+
+    // Begin the consultation by gathering a set of existing values from the user
+    ConsultationBegin initial_dialog(this);
+    initial_dialog.exec();
+    trace.Write(std::vector<expert_system::engines::explanation::Log>{
+            expert_system::engines::inference::forward::LogExisting(fact_database)}, fact_database);
+
+    // Continue to loop through the inference process
+    while (true) {
+        // Attempt to resolve the goal and log the Rules that were run
+        auto resolution = expert_system::engines::inference::backward::ResolveGoal(
+                goal_fact,
+                fact_database,
+                rule_database);
+        if (!resolution.logs_.empty()) {
+            trace.Write(resolution.logs_, fact_database);
+        }
+
+        // Catch if the goal has been resolved, or can no longer be resolved
+        if (resolution.outcome_ != expert_system::engines::inference::backward::GoalOutcome::kRequiresInput) {
+            // Stop the consultation and show the results
+            break;
+        }
+
+        // Generate a dialog to request one of the session values needed to resolve the goal
+        AdditionalRequest request_dialog(resolution.requests_,
+                                         trace,
+                                         this);
+
+        // Catch if the user wanted to finish the consultation
+        if (request_dialog.exec() == QDialog::Rejected) {
+            // Stop the consultation and show the results
+            break;
+        }
+    }
+
+    // Display the consultation results
+    ConsultationResult result_dialog(trace, this);
+    result_dialog.exec();
+
+    // Make sure to clean up before finishing
+    fact_database.Reset();
+    rule_database.ResetRules();
 }
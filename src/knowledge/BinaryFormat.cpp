@@ -0,0 +1,899 @@
+#include "BinaryFormat.hpp"
+
+#include <fstream>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include "utility/MappedFile.hpp"
+#include "utility/SymbolsJSON.hpp"
+
+namespace expert_system::knowledge::binary {
+
+    namespace {
+
+            /// The alignment of each section's first byte.
+        constexpr std::size_t kSectionAlignment = 8;
+
+        static_assert(sizeof(Header) == 128, "The Header layout must not change without a new kVersion");
+        static_assert(sizeof(StringRecord) == 8, "The StringRecord layout must not change without a new kVersion");
+        static_assert(sizeof(FactRecord) == 28, "The FactRecord layout must not change without a new kVersion");
+        static_assert(sizeof(RuleRecord) == 28, "The RuleRecord layout must not change without a new kVersion");
+        static_assert(sizeof(ConditionRecord) == 16, "The ConditionRecord layout must not change without a new kVersion");
+        static_assert(sizeof(AssignmentRecord) == 16, "The AssignmentRecord layout must not change without a new kVersion");
+
+            /**
+             * @brief Gathers the size of a section's records.
+             * @param [in] section The target section.
+             * @return The size of each record in bytes.
+             */
+        constexpr std::size_t RecordSize(Section section) {
+            switch (section) {
+                case Section::kStrings:
+                    return sizeof(StringRecord);
+                case Section::kFacts:
+                    return sizeof(FactRecord);
+                case Section::kEnumValues:
+                    return sizeof(std::uint32_t);
+                case Section::kRules:
+                    return sizeof(RuleRecord);
+                case Section::kConditions:
+                    return sizeof(ConditionRecord);
+                case Section::kAssignments:
+                    return sizeof(AssignmentRecord);
+                default:
+                    return 1;
+            }
+        }
+
+            /**
+             * @brief Stores the raw bits of a bool, int or float value.
+             * @tparam T The raw type of the value.
+             * @param [in] value The value to store.
+             * @return The raw bits.
+             */
+        template<class T>
+        std::uint32_t PackScalar(T value) {
+            // Store booleans as 0 or 1, and copy the bits of the other types
+            if constexpr (std::is_same_v<T, bool>) {
+                return value ? 1u : 0u;
+            } else {
+                static_assert(sizeof(T) == sizeof(std::uint32_t), "Unsupported scalar type");
+                std::uint32_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                return bits;
+            }
+        }
+
+            /**
+             * @brief Restores a bool, int or float value from its raw bits.
+             * @tparam T The raw type of the value.
+             * @param [in] bits The raw bits.
+             * @return The value.
+             */
+        template<class T>
+        T UnpackScalar(std::uint32_t bits) {
+            // Restore booleans from 0 or 1, and copy the bits of the other types
+            if constexpr (std::is_same_v<T, bool>) {
+                return bits != 0;
+            } else {
+                static_assert(sizeof(T) == sizeof(std::uint32_t), "Unsupported scalar type");
+                T value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+        }
+
+            /// Gathers the records of each section while encoding, interning every string once.
+        class Encoder {
+        public:
+                /**
+                 * @brief Gathers the index of a string in the string table, adding it if it is new.
+                 * @param [in] value The string.
+                 * @return The string's index.
+                 */
+            std::uint32_t Intern(const std::string& value) {
+                // Catch a string that is already stored
+                auto search_result = string_indices_.find(value);
+                if (search_result != string_indices_.end()) {
+                    return search_result->second;
+                }
+
+                // Append the string to the table
+                auto index = (std::uint32_t) strings_.size();
+                strings_.push_back({(std::uint32_t) string_data_.size(), (std::uint32_t) value.size()});
+                string_data_ += value;
+                string_indices_.emplace(value, index);
+                return index;
+            }
+
+                /**
+                 * @brief Adds a Fact's record.
+                 * @param [in] name The Fact's name.
+                 * @param [in] fact The Fact.
+                 */
+            void AddFact(const std::string& name, const facts::VariantFact& fact) {
+                // Fill in the common fields
+                FactRecord record{};
+                record.name_ = Intern(name);
+                record.type_ = (std::uint8_t) fact.type_;
+
+                // Split the logic based on the Fact's type
+                switch (fact.type_) {
+                    case utility::ExpertSystemTypes::kBool: {
+                        // Store the description and Range
+                        FillFact(std::get<facts::BoolFact>(fact.fact_), record);
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kInt: {
+                        // Store the description and Range
+                        FillFact(std::get<facts::IntFact>(fact.fact_), record);
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kFloat: {
+                        // Store the description and Range
+                        FillFact(std::get<facts::FloatFact>(fact.fact_), record);
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kEnum: {
+                        // Store the enum value names, followed by the description and Range as enum positions
+                        const auto& raw_fact = std::get<facts::EnumFact>(fact.fact_);
+                        record.enum_first_ = (std::uint32_t) enum_values_.size();
+                        for (const auto& current_name: raw_fact.enum_.List()) {
+                            enum_values_.push_back(Intern(current_name));
+                        }
+                        record.enum_count_ = (std::uint32_t) enum_values_.size() - record.enum_first_;
+                        FillFact(raw_fact.fact_, record);
+                        break;
+                    }
+                    default: {
+                        // Store no more data
+                        record.type_ = (std::uint8_t) utility::ExpertSystemTypes::kUnknown;
+                        record.description_ = Intern("");
+                        break;
+                    }
+                }
+                facts_.push_back(record);
+            }
+
+                /**
+                 * @brief Adds a Rule's record, along with its Condition and Assignment records.
+                 * @param [in] name The Rule's name.
+                 * @param [in] rule The Rule.
+                 */
+            void AddRule(const std::string& name, const rules::Rule& rule) {
+                // Fill in the Rule's own fields
+                RuleRecord record{};
+                record.name_ = Intern(name);
+                record.description_ = Intern(rule.GetDescription());
+                record.priority_ = rule.priority_;
+
+                // Store the root Condition, followed by the condition chain
+                record.condition_first_ = (std::uint32_t) conditions_.size();
+                conditions_.push_back(MakeCondition(rule.trigger_.root_condition_, rules::ConnectorType::kAnd));
+                for (const auto& current_pair: rule.trigger_.condition_chain_) {
+                    conditions_.push_back(MakeCondition(current_pair.second, current_pair.first));
+                }
+                record.condition_count_ = (std::uint32_t) conditions_.size() - record.condition_first_;
+
+                // Store the Assignments
+                record.assignment_first_ = (std::uint32_t) assignments_.size();
+                for (const auto& current_assignment: rule.response_.assignments_) {
+                    assignments_.push_back(MakeAssignment(current_assignment));
+                }
+                record.assignment_count_ = (std::uint32_t) assignments_.size() - record.assignment_first_;
+                rules_.push_back(record);
+            }
+
+                /**
+                 * @brief Lays out the header and sections.
+                 * @return The bytes of the binary knowledge base.
+                 */
+            std::vector<char> Finish() const {
+                // Start with a placeholder for the header
+                std::vector<char> bytes(sizeof(Header), 0);
+                Header header{};
+                header.magic_ = kMagic;
+                header.version_ = kVersion;
+                header.byte_order_ = kByteOrderMark;
+
+                // Append each section after padding to its alignment
+                auto append = [&](Section section, const void* data, std::size_t count) {
+                    bytes.resize((bytes.size() + kSectionAlignment - 1) / kSectionAlignment * kSectionAlignment, 0);
+                    header.sections_[(std::size_t) section] = {bytes.size(), count};
+                    auto section_bytes = count * RecordSize(section);
+                    if (section_bytes != 0) {
+                        bytes.insert(bytes.end(), static_cast<const char*>(data),
+                                     static_cast<const char*>(data) + section_bytes);
+                    }
+                };
+                append(Section::kStrings, strings_.data(), strings_.size());
+                append(Section::kStringData, string_data_.data(), string_data_.size());
+                append(Section::kFacts, facts_.data(), facts_.size());
+                append(Section::kEnumValues, enum_values_.data(), enum_values_.size());
+                append(Section::kRules, rules_.data(), rules_.size());
+                append(Section::kConditions, conditions_.data(), conditions_.size());
+                append(Section::kAssignments, assignments_.data(), assignments_.size());
+
+                // Fill in the header now that the sections are placed
+                std::memcpy(bytes.data(), &header, sizeof(header));
+                return bytes;
+            }
+
+        private:
+                /**
+                 * @brief Stores a raw Fact's description and Range into its record.
+                 * @tparam T The raw type of the Fact.
+                 * @param [in] fact The raw Fact.
+                 * @param [in,out] record The Fact's record.
+                 */
+            template<class T>
+            void FillFact(const facts::Fact<T>& fact, FactRecord& record) {
+                // Store the description
+                record.description_ = Intern(fact.GetDescription());
+
+                // Store the Range, if the Fact has one
+                auto fact_range = fact.GetRange();
+                if (fact_range.has_value()) {
+                    record.has_range_ = 1;
+                    record.bounds_inclusive_ = fact_range->bounds_inclusive_ ? 1 : 0;
+                    record.range_min_ = PackScalar<T>(fact_range->min_);
+                    record.range_max_ = PackScalar<T>(fact_range->max_);
+                }
+            }
+
+                /**
+                 * @brief Creates the record of a raw Condition.
+                 * @tparam T The raw type of the Condition.
+                 * @param [in] condition The raw Condition.
+                 * @param [in] connector The ConnectorType joining the Condition to the chain.
+                 * @return The Condition's record.
+                 */
+            template<class T>
+            ConditionRecord FillCondition(const rules::Condition<T>& condition, rules::ConnectorType connector) {
+                // Store the common fields
+                ConditionRecord record{};
+                record.fact_ = Intern(condition.fact_);
+                record.condition_ = (std::uint8_t) condition.condition_;
+                record.connector_ = (std::uint8_t) connector;
+                record.invert_ = condition.invert_ ? 1 : 0;
+                record.confidence_ = condition.confidence_factor_.Get();
+
+                // Store the target value, enum targets are stored by name
+                if constexpr (std::is_same_v<T, std::string>) {
+                    record.target_ = Intern(condition.target_);
+                } else {
+                    record.target_ = PackScalar<T>(condition.target_);
+                }
+                return record;
+            }
+
+                /**
+                 * @brief Creates the record of a Condition.
+                 * @param [in] condition The Condition.
+                 * @param [in] connector The ConnectorType joining the Condition to the chain.
+                 * @return The Condition's record.
+                 */
+            ConditionRecord MakeCondition(const rules::VariantCondition& condition, rules::ConnectorType connector) {
+                // Split the logic based on the Condition's type
+                ConditionRecord record{};
+                switch (condition.type_) {
+                    case utility::ExpertSystemTypes::kBool: {
+                        record = FillCondition(std::get<rules::BoolCondition>(condition.condition_), connector);
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kInt: {
+                        record = FillCondition(std::get<rules::IntCondition>(condition.condition_), connector);
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kFloat: {
+                        record = FillCondition(std::get<rules::FloatCondition>(condition.condition_), connector);
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kEnum: {
+                        record = FillCondition(std::get<rules::EnumCondition>(condition.condition_), connector);
+                        break;
+                    }
+                    default: {
+                        // Store an empty Condition
+                        record.fact_ = Intern("");
+                        record.connector_ = (std::uint8_t) connector;
+                        break;
+                    }
+                }
+
+                // Store the type
+                record.type_ = (std::uint8_t) condition.type_;
+                return record;
+            }
+
+                /**
+                 * @brief Creates the record of a raw Assignment.
+                 * @tparam T The raw type of the Assignment.
+                 * @param [in] assignment The raw Assignment.
+                 * @return The Assignment's record.
+                 */
+            template<class T>
+            AssignmentRecord FillAssignment(const rules::Assignment<T>& assignment) {
+                // Store the common fields
+                AssignmentRecord record{};
+                record.fact_ = Intern(assignment.fact_);
+                record.confidence_ = assignment.confidence_factor_.Get();
+
+                // Store the value, enum values are stored by name
+                if constexpr (std::is_same_v<T, std::string>) {
+                    record.value_ = Intern(assignment.value_);
+                } else {
+                    record.value_ = PackScalar<T>(assignment.value_);
+                }
+                return record;
+            }
+
+                /**
+                 * @brief Creates the record of an Assignment.
+                 * @param [in] assignment The Assignment.
+                 * @return The Assignment's record.
+                 */
+            AssignmentRecord MakeAssignment(const rules::VariantAssignment& assignment) {
+                // Split the logic based on the Assignment's type
+                AssignmentRecord record{};
+                switch (assignment.type_) {
+                    case utility::ExpertSystemTypes::kBool: {
+                        record = FillAssignment(std::get<rules::BoolAssignment>(assignment.assignment_));
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kInt: {
+                        record = FillAssignment(std::get<rules::IntAssignment>(assignment.assignment_));
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kFloat: {
+                        record = FillAssignment(std::get<rules::FloatAssignment>(assignment.assignment_));
+                        break;
+                    }
+                    case utility::ExpertSystemTypes::kEnum: {
+                        record = FillAssignment(std::get<rules::EnumAssignment>(assignment.assignment_));
+                        break;
+                    }
+                    default: {
+                        // Store an empty Assignment
+                        record.fact_ = Intern("");
+                        break;
+                    }
+                }
+
+                // Store the type
+                record.type_ = (std::uint8_t) assignment.type_;
+                return record;
+            }
+
+                /// The records of Section::kStrings.
+            std::vector<StringRecord> strings_;
+
+                /// The bytes of Section::kStringData.
+            std::string string_data_;
+
+                /// Maps each interned string to its index.
+            std::unordered_map<std::string, std::uint32_t> string_indices_;
+
+                /// The records of Section::kFacts.
+            std::vector<FactRecord> facts_;
+
+                /// The records of Section::kEnumValues.
+            std::vector<std::uint32_t> enum_values_;
+
+                /// The records of Section::kRules.
+            std::vector<RuleRecord> rules_;
+
+                /// The records of Section::kConditions.
+            std::vector<ConditionRecord> conditions_;
+
+                /// The records of Section::kAssignments.
+            std::vector<AssignmentRecord> assignments_;
+        };
+
+            /**
+             * @brief Checks that a run of records lies within a section.
+             * @param [in] view The viewed binary knowledge base.
+             * @param [in] section The target section.
+             * @param [in] first The index of the first record.
+             * @param [in] count The amount of records.
+             * @return True if every record is within the section, False otherwise.
+             */
+        bool InSection(const KnowledgeView& view, Section section, std::uint32_t first, std::uint32_t count) {
+            // Widen before adding, so the check can't overflow
+            return (std::uint64_t) first + count <= view.Count(section);
+        }
+
+            /**
+             * @brief Checks that a raw type lies within its enum class.
+             * @param [in] type The raw ExpertSystemTypes.
+             * @return True if the type is valid, False otherwise.
+             */
+        bool ValidType(std::uint8_t type) {
+            // Check against the last symbol
+            return type <= (std::uint8_t) utility::ExpertSystemTypes::kEnum;
+        }
+
+            /**
+             * @brief Restores a raw Fact's description and Range from its record.
+             * @tparam T The raw type of the Fact.
+             * @param [in] view The viewed binary knowledge base.
+             * @param [in] record The Fact's record.
+             * @param [in,out] fact The raw Fact.
+             * @return True if the record was valid, False otherwise.
+             */
+        template<class T>
+        bool DecodeFact(const KnowledgeView& view, const FactRecord& record, facts::Fact<T>& fact) {
+            // Restore the description
+            auto description = view.String(record.description_);
+            if (!description.has_value()) {
+                return false;
+            }
+            fact.SetDescription(std::string(description.value()));
+
+            // Restore the Range, if the Fact has one
+            if (record.has_range_ == 0) {
+                return true;
+            }
+            return fact.SetRange(UnpackScalar<T>(record.range_min_), UnpackScalar<T>(record.range_max_),
+                                 record.bounds_inclusive_ != 0);
+        }
+
+            /**
+             * @brief Restores a raw Condition from its record.
+             * @tparam T The raw type of the Condition.
+             * @param [in] view The viewed binary knowledge base.
+             * @param [in] record The Condition's record.
+             * @param [in,out] condition The raw Condition.
+             * @return True if the record was valid, False otherwise.
+             */
+        template<class T>
+        bool DecodeCondition(const KnowledgeView& view, const ConditionRecord& record, rules::Condition<T>& condition) {
+            // Restore the common fields
+            auto fact_name = view.String(record.fact_);
+            if (!fact_name.has_value() || (record.condition_ > (std::uint8_t) rules::ConditionType::kGreaterThan)) {
+                return false;
+            }
+            condition.fact_ = std::string(fact_name.value());
+            condition.condition_ = (rules::ConditionType) record.condition_;
+            condition.invert_ = record.invert_ != 0;
+            condition.confidence_factor_ = utility::Confidence(record.confidence_);
+
+            // Restore the target value, enum targets are stored by name
+            if constexpr (std::is_same_v<T, std::string>) {
+                auto target_name = view.String(record.target_);
+                if (!target_name.has_value()) {
+                    return false;
+                }
+                condition.target_ = std::string(target_name.value());
+            } else {
+                condition.target_ = UnpackScalar<T>(record.target_);
+            }
+            return true;
+        }
+
+            /**
+             * @brief Restores a Condition from its record.
+             * @param [in] view The viewed binary knowledge base.
+             * @param [in] record The Condition's record.
+             * @return The Condition if the record was valid, or std::nullopt otherwise.
+             */
+        std::optional<rules::VariantCondition> DecodeVariantCondition(const KnowledgeView& view,
+                                                                      const ConditionRecord& record) {
+            // Catch an invalid type
+            if (!ValidType(record.type_)) {
+                return std::nullopt;
+            }
+
+            // Split the logic based on the Condition's type, constructing the raw Condition in place
+            rules::VariantCondition condition;
+            condition.type_ = (utility::ExpertSystemTypes) record.type_;
+            bool decoded = true;
+            switch (condition.type_) {
+                case utility::ExpertSystemTypes::kBool: {
+                    decoded = DecodeCondition(view, record, condition.condition_.emplace<rules::BoolCondition>());
+                    break;
+                }
+                case utility::ExpertSystemTypes::kInt: {
+                    decoded = DecodeCondition(view, record, condition.condition_.emplace<rules::IntCondition>());
+                    break;
+                }
+                case utility::ExpertSystemTypes::kFloat: {
+                    decoded = DecodeCondition(view, record, condition.condition_.emplace<rules::FloatCondition>());
+                    break;
+                }
+                case utility::ExpertSystemTypes::kEnum: {
+                    decoded = DecodeCondition(view, record, condition.condition_.emplace<rules::EnumCondition>());
+                    break;
+                }
+                default: {
+                    // Keep the empty Condition
+                    break;
+                }
+            }
+
+            // Catch an invalid record
+            if (!decoded) {
+                return std::nullopt;
+            }
+            return condition;
+        }
+
+            /**
+             * @brief Restores a raw Assignment from its record.
+             * @tparam T The raw type of the Assignment.
+             * @param [in] view The viewed binary knowledge base.
+             * @param [in] record The Assignment's record.
+             * @param [in,out] assignment The raw Assignment.
+             * @return True if the record was valid, False otherwise.
+             */
+        template<class T>
+        bool DecodeAssignment(const KnowledgeView& view, const AssignmentRecord& record,
+                              rules::Assignment<T>& assignment) {
+            // Restore the common fields
+            auto fact_name = view.String(record.fact_);
+            if (!fact_name.has_value()) {
+                return false;
+            }
+            assignment.fact_ = std::string(fact_name.value());
+            assignment.confidence_factor_ = utility::Confidence(record.confidence_);
+
+            // Restore the value, enum values are stored by name
+            if constexpr (std::is_same_v<T, std::string>) {
+                auto value_name = view.String(record.value_);
+                if (!value_name.has_value()) {
+                    return false;
+                }
+                assignment.value_ = std::string(value_name.value());
+            } else {
+                assignment.value_ = UnpackScalar<T>(record.value_);
+            }
+            return true;
+        }
+
+            /**
+             * @brief Restores an Assignment from its record.
+             * @param [in] view The viewed binary knowledge base.
+             * @param [in] record The Assignment's record.
+             * @return The Assignment if the record was valid, or std::nullopt otherwise.
+             */
+        std::optional<rules::VariantAssignment> DecodeVariantAssignment(const KnowledgeView& view,
+                                                                        const AssignmentRecord& record) {
+            // Catch an invalid type
+            if (!ValidType(record.type_)) {
+                return std::nullopt;
+            }
+
+            // Split the logic based on the Assignment's type, constructing the raw Assignment in place
+            rules::VariantAssignment assignment;
+            assignment.type_ = (utility::ExpertSystemTypes) record.type_;
+            bool decoded = true;
+            switch (assignment.type_) {
+                case utility::ExpertSystemTypes::kBool: {
+                    decoded = DecodeAssignment(view, record, assignment.assignment_.emplace<rules::BoolAssignment>());
+                    break;
+                }
+                case utility::ExpertSystemTypes::kInt: {
+                    decoded = DecodeAssignment(view, record, assignment.assignment_.emplace<rules::IntAssignment>());
+                    break;
+                }
+                case utility::ExpertSystemTypes::kFloat: {
+                    decoded = DecodeAssignment(view, record, assignment.assignment_.emplace<rules::FloatAssignment>());
+                    break;
+                }
+                case utility::ExpertSystemTypes::kEnum: {
+                    decoded = DecodeAssignment(view, record, assignment.assignment_.emplace<rules::EnumAssignment>());
+                    break;
+                }
+                default: {
+                    // Keep the empty Assignment
+                    break;
+                }
+            }
+
+            // Catch an invalid record
+            if (!decoded) {
+                return std::nullopt;
+            }
+            return assignment;
+        }
+
+            /**
+             * @brief Restores a Fact from its record, and stores it in a FactDatabase.
+             * @param [in] view The viewed binary knowledge base.
+             * @param [in] record The Fact's record.
+             * @param [in,out] fact_database The FactDatabase to store the Fact in.
+             * @return True if the record was valid, False otherwise.
+             */
+        bool DecodeVariantFact(const KnowledgeView& view, const FactRecord& record,
+                               facts::FactDatabase& fact_database) {
+            // Catch an invalid name or type
+            auto fact_name = view.String(record.name_);
+            if (!fact_name.has_value() || !ValidType(record.type_)) {
+                return false;
+            }
+
+            // Create the Fact, catching a repeated name
+            auto created_fact = fact_database.Create(std::string(fact_name.value()),
+                                                     (utility::ExpertSystemTypes) record.type_);
+            if (!created_fact.has_value()) {
+                return false;
+            }
+
+            // Split the logic based on the Fact's type
+            auto& new_fact = created_fact->get();
+            switch (new_fact.type_) {
+                case utility::ExpertSystemTypes::kBool: {
+                    return DecodeFact(view, record, std::get<facts::BoolFact>(new_fact.fact_));
+                }
+                case utility::ExpertSystemTypes::kInt: {
+                    return DecodeFact(view, record, std::get<facts::IntFact>(new_fact.fact_));
+                }
+                case utility::ExpertSystemTypes::kFloat: {
+                    return DecodeFact(view, record, std::get<facts::FloatFact>(new_fact.fact_));
+                }
+                case utility::ExpertSystemTypes::kEnum: {
+                    // Catch enum value names outside of their section, or Range positions outside of the enum
+                    auto& raw_fact = std::get<facts::EnumFact>(new_fact.fact_);
+                    if (!InSection(view, Section::kEnumValues, record.enum_first_, record.enum_count_)
+                        || ((record.has_range_ != 0)
+                            && ((UnpackScalar<int>(record.range_min_) < 0)
+                                || (UnpackScalar<int>(record.range_max_) < 0)
+                                || ((std::uint32_t) UnpackScalar<int>(record.range_min_) >= record.enum_count_)
+                                || ((std::uint32_t) UnpackScalar<int>(record.range_max_) >= record.enum_count_)))) {
+                        return false;
+                    }
+
+                    // Restore the enum value names in ascending order, catching repeated names
+                    for (std::uint32_t index = 0; index < record.enum_count_; index++) {
+                        auto value_name = view.String(view.At<std::uint32_t>(Section::kEnumValues,
+                                                                             record.enum_first_ + index));
+                        if (!value_name.has_value() || !raw_fact.enum_.PushBack(std::string(value_name.value()))) {
+                            return false;
+                        }
+                    }
+                    return DecodeFact(view, record, raw_fact.fact_);
+                }
+                default: {
+                    // Keep the empty Fact
+                    return true;
+                }
+            }
+        }
+
+            /**
+             * @brief Restores a Rule from its record, and stores it in a RuleDatabase.
+             * @param [in] view The viewed binary knowledge base.
+             * @param [in] record The Rule's record.
+             * @param [in,out] rule_database The RuleDatabase to store the Rule in, without indexing it.
+             * @return True if the record was valid, False otherwise.
+             */
+        bool DecodeRule(const KnowledgeView& view, const RuleRecord& record, rules::RuleDatabase& rule_database) {
+            // Catch an invalid name or description, or Conditions and Assignments outside of their sections
+            auto rule_name = view.String(record.name_);
+            auto description = view.String(record.description_);
+            if (!rule_name.has_value() || !description.has_value() || (record.condition_count_ == 0)
+                || !InSection(view, Section::kConditions, record.condition_first_, record.condition_count_)
+                || !InSection(view, Section::kAssignments, record.assignment_first_, record.assignment_count_)) {
+                return false;
+            }
+
+            // Restore the Rule's own fields
+            rules::Rule new_rule;
+            new_rule.SetDescription(std::string(description.value()));
+            new_rule.priority_ = record.priority_;
+
+            // Restore the root Condition, followed by the condition chain
+            for (std::uint32_t index = 0; index < record.condition_count_; index++) {
+                auto condition_record = view.At<ConditionRecord>(Section::kConditions, record.condition_first_ + index);
+                auto condition = DecodeVariantCondition(view, condition_record);
+                if (!condition.has_value()) {
+                    return false;
+                }
+                if (index == 0) {
+                    new_rule.trigger_.root_condition_ = std::move(condition.value());
+                } else {
+                    // Catch an invalid connector
+                    if (condition_record.connector_ > (std::uint8_t) rules::ConnectorType::kXor) {
+                        return false;
+                    }
+                    new_rule.trigger_.condition_chain_.emplace_back((rules::ConnectorType) condition_record.connector_,
+                                                                    std::move(condition.value()));
+                }
+            }
+
+            // Restore the Assignments
+            for (std::uint32_t index = 0; index < record.assignment_count_; index++) {
+                auto assignment = DecodeVariantAssignment(
+                        view, view.At<AssignmentRecord>(Section::kAssignments, record.assignment_first_ + index));
+                if (!assignment.has_value()) {
+                    return false;
+                }
+                new_rule.response_.assignments_.push_back(std::move(assignment.value()));
+            }
+
+            // Store the Rule, catching a repeated name
+            return rule_database.managed_rules_.emplace(std::string(rule_name.value()), std::move(new_rule)).second;
+        }
+
+    } // namespace
+
+    BinaryOutcome KnowledgeView::Open(const char* data, std::size_t size) {
+        // Catch bytes that don't begin with the magic
+        data_ = nullptr;
+        size_ = 0;
+        if ((data == nullptr) || (size < kMagic.size()) || (std::memcmp(data, kMagic.data(), kMagic.size()) != 0)) {
+            return BinaryOutcome::kInvalidHeader;
+        }
+
+        // Catch a header that was cut off
+        if (size < sizeof(Header)) {
+            return BinaryOutcome::kTruncated;
+        }
+
+        // Copy the header out, and catch a file written in another byte order or version
+        std::memcpy(&header_, data, sizeof(Header));
+        if (header_.byte_order_ != kByteOrderMark) {
+            return BinaryOutcome::kInvalidHeader;
+        }
+        if (header_.version_ != kVersion) {
+            return BinaryOutcome::kUnsupportedVersion;
+        }
+
+        // Catch any section that extends past the end of the bytes
+        for (std::size_t section = 0; section < (std::size_t) Section::kCount; section++) {
+            const auto& current_section = header_.sections_[section];
+            if ((current_section.offset_ > size)
+                || (current_section.count_ > (size - current_section.offset_) / RecordSize((Section) section))) {
+                return BinaryOutcome::kTruncated;
+            }
+        }
+
+        // Store the view
+        data_ = data;
+        size_ = size;
+        return BinaryOutcome::kSuccess;
+    }
+
+    std::size_t KnowledgeView::Count(Section section) const {
+        // Catch an empty view
+        if (data_ == nullptr) {
+            return 0;
+        }
+
+        // Provide the section's record count
+        return (std::size_t) header_.sections_[(std::size_t) section].count_;
+    }
+
+    std::optional<std::string_view> KnowledgeView::String(std::uint32_t index) const {
+        // Catch an invalid index
+        if (index >= Count(Section::kStrings)) {
+            return std::nullopt;
+        }
+
+        // Catch a string that extends past the string data
+        auto record = At<StringRecord>(Section::kStrings, index);
+        if ((std::uint64_t) record.offset_ + record.length_ > Count(Section::kStringData)) {
+            return std::nullopt;
+        }
+
+        // Provide a view into the string data
+        return std::string_view(data_ + header_.sections_[(std::size_t) Section::kStringData].offset_ + record.offset_,
+                                record.length_);
+    }
+
+    std::vector<char> Encode(const facts::FactDatabase& fact_database, const rules::RuleDatabase& rule_database) {
+        // Store the Facts in handle order
+        Encoder encoder;
+        fact_database.IterateHandles(facts::FactFilter::kAll, [&](facts::FactHandle handle) {
+            encoder.AddFact(fact_database.Name(handle)->get(), fact_database.Find(handle)->get());
+        });
+
+        // Store the Rules in name order
+        for (const auto& map_iterator: rule_database.managed_rules_) {
+            encoder.AddRule(map_iterator.first, map_iterator.second);
+        }
+
+        // Lay out the sections
+        return encoder.Finish();
+    }
+
+    BinaryOutcome Decode(const KnowledgeView& view, facts::FactDatabase& fact_database,
+                         rules::RuleDatabase& rule_database) {
+        // Restore the Facts
+        facts::FactDatabase new_facts;
+        for (std::size_t index = 0; index < view.Count(Section::kFacts); index++) {
+            if (!DecodeVariantFact(view, view.At<FactRecord>(Section::kFacts, index), new_facts)) {
+                return BinaryOutcome::kInvalidRecord;
+            }
+        }
+
+        // Restore the Rules, and build their Fact dependency index once
+        rules::RuleDatabase new_rules;
+        for (std::size_t index = 0; index < view.Count(Section::kRules); index++) {
+            if (!DecodeRule(view, view.At<RuleRecord>(Section::kRules, index), new_rules)) {
+                return BinaryOutcome::kInvalidRecord;
+            }
+        }
+        new_rules.Reindex();
+
+        // Replace the databases
+        fact_database = std::move(new_facts);
+        rule_database = std::move(new_rules);
+        return BinaryOutcome::kSuccess;
+    }
+
+    bool IsBinaryFile(const std::string& file_name) {
+        // Attempt to read the first bytes of the file
+        std::ifstream file_stream(file_name, std::ifstream::in | std::ifstream::binary);
+        std::array<char, 4> file_magic{};
+        if (!file_stream.read(file_magic.data(), file_magic.size())) {
+            return false;
+        }
+
+        // Compare the bytes to the magic
+        return file_magic == kMagic;
+    }
+
+    bool Save(const std::string& file_name, const facts::FactDatabase& fact_database,
+              const rules::RuleDatabase& rule_database) {
+        // Attempt to open the requested file
+        std::ofstream file_stream(file_name, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+        if (!file_stream.is_open()) {
+            return false;
+        }
+
+        // Encode the databases and write them out
+        auto bytes = Encode(fact_database, rule_database);
+        file_stream.write(bytes.data(), (std::streamsize) bytes.size());
+        return file_stream.good();
+    }
+
+    BinaryOutcome Load(const std::string& file_name, facts::FactDatabase& fact_database,
+                       rules::RuleDatabase& rule_database) {
+        // Attempt to map the requested file
+        utility::MappedFile mapped_file;
+        if (!mapped_file.Open(file_name)) {
+            return BinaryOutcome::kUnableToOpen;
+        }
+
+        // View the mapped bytes and decode them in place
+        KnowledgeView view;
+        auto outcome = view.Open(mapped_file.Data(), mapped_file.Size());
+        if (outcome != BinaryOutcome::kSuccess) {
+            return outcome;
+        }
+        return Decode(view, fact_database, rule_database);
+    }
+
+    bool ConvertFromJSON(const nlohmann::json& json_store, const std::string& file_name) {
+        // Catch not all data being provided
+        if (!json_store.is_object()
+            || (json_store.find(utility::JSON_ID_DATABASE_FACTS) == json_store.end())
+            || (json_store.find(utility::JSON_ID_DATABASE_RULES) == json_store.end())) {
+            return false;
+        }
+
+        // Parse the databases and encode them
+        return Save(file_name,
+                    json_store.at(utility::JSON_ID_DATABASE_FACTS).get<facts::FactDatabase>(),
+                    json_store.at(utility::JSON_ID_DATABASE_RULES).get<rules::RuleDatabase>());
+    }
+
+    BinaryOutcome ConvertToJSON(const std::string& file_name, nlohmann::json& json_store) {
+        // Attempt to decode the databases
+        facts::FactDatabase fact_database;
+        rules::RuleDatabase rule_database;
+        auto outcome = Load(file_name, fact_database, rule_database);
+        if (outcome != BinaryOutcome::kSuccess) {
+            return outcome;
+        }
+
+        // Export the databases in the same layout as the GUI's saved files
+        json_store = nlohmann::json::object();
+        json_store[utility::JSON_ID_DATABASE_FACTS] = fact_database;
+        json_store[utility::JSON_ID_DATABASE_RULES] = rule_database;
+        return BinaryOutcome::kSuccess;
+    }
+
+} // namespace expert_system::knowledge::binary
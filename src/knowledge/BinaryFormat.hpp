@@ -0,0 +1,324 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "knowledge/facts/FactDatabase.hpp"
+#include "knowledge/rules/RuleDatabase.hpp"
+
+namespace expert_system::knowledge::binary {
+
+        /// The symbolic representations for the outcomes of reading a binary knowledge base.
+    enum class BinaryOutcome {
+        kUnknown,
+        kSuccess,
+        kUnableToOpen,
+        kInvalidHeader,
+        kUnsupportedVersion,
+        kTruncated,
+        kInvalidRecord
+    };
+
+        /// JSON serialization for the BinaryOutcome enum.
+    NLOHMANN_JSON_SERIALIZE_ENUM(BinaryOutcome,
+                                {{BinaryOutcome::kUnknown, nullptr},
+                                 {BinaryOutcome::kSuccess, "Success"},
+                                 {BinaryOutcome::kUnableToOpen, "UnableToOpen"},
+                                 {BinaryOutcome::kInvalidHeader, "InvalidHeader"},
+                                 {BinaryOutcome::kUnsupportedVersion, "UnsupportedVersion"},
+                                 {BinaryOutcome::kTruncated, "Truncated"},
+                                 {BinaryOutcome::kInvalidRecord, "InvalidRecord"}})
+
+        /// The bytes that every binary knowledge base begins with.
+    constexpr std::array<char, 4> kMagic = {'E', 'S', 'K', 'B'};
+
+        /// The version of the binary layout written by Encode().
+    constexpr std::uint32_t kVersion = 1;
+
+        /// A value written in the writer's byte order, used to reject files from a machine with another byte order.
+    constexpr std::uint32_t kByteOrderMark = 0x01020304;
+
+        /// The identifiers of the sections of a binary knowledge base, in the order they are written.
+    enum class Section {
+        kStrings,
+        kStringData,
+        kFacts,
+        kEnumValues,
+        kRules,
+        kConditions,
+        kAssignments,
+        kCount
+    };
+
+        /// The location of a section, relative to the start of the file.
+    struct SectionRecord {
+            /// The offset of the section's first byte, aligned to 8 bytes.
+        std::uint64_t offset_;
+
+            /// The amount of records in the section, or the amount of bytes for Section::kStringData.
+        std::uint64_t count_;
+    };
+
+        /// The fixed-size start of a binary knowledge base.
+    struct Header {
+            /// Always kMagic.
+        std::array<char, 4> magic_;
+
+            /// The version of the layout.
+        std::uint32_t version_;
+
+            /// Always kByteOrderMark, in the writer's byte order.
+        std::uint32_t byte_order_;
+
+            /// Unused, keeps the sections aligned.
+        std::uint32_t padding_;
+
+            /// The location of each section, indexed by Section.
+        std::array<SectionRecord, (std::size_t) Section::kCount> sections_;
+    };
+
+        /// A string stored in the string table, referred to by its index.
+    struct StringRecord {
+            /// The offset of the string's first byte within Section::kStringData.
+        std::uint32_t offset_;
+
+            /// The amount of bytes in the string.
+        std::uint32_t length_;
+    };
+
+        /**
+         * @brief A stored Fact.
+         * The Range bounds hold the raw bits of a bool, int or float, while enum Facts use enum positions.
+         */
+    struct FactRecord {
+            /// The string index of the Fact's name.
+        std::uint32_t name_;
+
+            /// The string index of the Fact's description.
+        std::uint32_t description_;
+
+            /// The Fact's ExpertSystemTypes.
+        std::uint8_t type_;
+
+            /// 1 if the Fact has a Range, 0 otherwise.
+        std::uint8_t has_range_;
+
+            /// 1 if the Range's bounds are inclusive, 0 otherwise.
+        std::uint8_t bounds_inclusive_;
+
+            /// Unused, keeps the record aligned.
+        std::uint8_t padding_;
+
+            /// The raw bits of the Range's minimum.
+        std::uint32_t range_min_;
+
+            /// The raw bits of the Range's maximum.
+        std::uint32_t range_max_;
+
+            /// The index of the first enum value name in Section::kEnumValues.
+        std::uint32_t enum_first_;
+
+            /// The amount of enum value names, in ascending order.
+        std::uint32_t enum_count_;
+    };
+
+        /// A stored Rule, owning consecutive Condition and Assignment records.
+    struct RuleRecord {
+            /// The string index of the Rule's name.
+        std::uint32_t name_;
+
+            /// The string index of the Rule's description.
+        std::uint32_t description_;
+
+            /// The Rule's priority.
+        std::int32_t priority_;
+
+            /// The index of the Rule's root Condition in Section::kConditions, followed by its condition chain.
+        std::uint32_t condition_first_;
+
+            /// The amount of Conditions, including the root Condition.
+        std::uint32_t condition_count_;
+
+            /// The index of the Rule's first Assignment in Section::kAssignments.
+        std::uint32_t assignment_first_;
+
+            /// The amount of Assignments.
+        std::uint32_t assignment_count_;
+    };
+
+        /// A stored Condition, the target holds the raw bits of a bool, int or float, or a string index for enums.
+    struct ConditionRecord {
+            /// The string index of the target Fact's name.
+        std::uint32_t fact_;
+
+            /// The Condition's ExpertSystemTypes.
+        std::uint8_t type_;
+
+            /// The Condition's ConditionType.
+        std::uint8_t condition_;
+
+            /// The ConnectorType joining the Condition to the chain, unused for a root Condition.
+        std::uint8_t connector_;
+
+            /// 1 if the Condition's outcome is inverted, 0 otherwise.
+        std::uint8_t invert_;
+
+            /// The raw bits of the target value.
+        std::uint32_t target_;
+
+            /// The Condition's confidence factor.
+        float confidence_;
+    };
+
+        /// A stored Assignment, the value holds the raw bits of a bool, int or float, or a string index for enums.
+    struct AssignmentRecord {
+            /// The string index of the target Fact's name.
+        std::uint32_t fact_;
+
+            /// The Assignment's ExpertSystemTypes.
+        std::uint8_t type_;
+
+            /// Unused, keeps the record aligned.
+        std::array<std::uint8_t, 3> padding_;
+
+            /// The raw bits of the value to assign.
+        std::uint32_t value_;
+
+            /// The Assignment's confidence factor.
+        float confidence_;
+    };
+
+        /**
+         * @brief A read-only view of a binary knowledge base in memory, without copying any of it.
+         * Records are read directly from the viewed bytes, and strings are provided as views into the string table.
+         * @warning The viewed bytes must outlive the KnowledgeView!
+         */
+    class KnowledgeView {
+    public:
+            /// Default constructor, creates an empty view.
+        KnowledgeView() = default;
+
+            /**
+             * @brief Attempts to view a binary knowledge base, checking its header and section bounds.
+             * @param [in] data A pointer to the first byte.
+             * @param [in] size The amount of bytes.
+             * @return kSuccess if the bytes can be viewed, or the reason they can't otherwise.
+             * @note The records themselves are checked as they are decoded, see Decode().
+             */
+        BinaryOutcome Open(const char* data, std::size_t size);
+
+            /**
+             * @brief Gathers the amount of records in a section.
+             * @param [in] section The target section.
+             * @return The amount of records, or bytes for Section::kStringData.
+             */
+        [[nodiscard]] std::size_t Count(Section section) const;
+
+            /**
+             * @brief Attempts to gather a string from the string table.
+             * @param [in] index The string's index.
+             * @return A view of the string if successful, or std::nullopt otherwise.
+             */
+        [[nodiscard]] std::optional<std::string_view> String(std::uint32_t index) const;
+
+            /**
+             * @brief Gathers a copy of a record from a section.
+             * @tparam Record The type of the section's records.
+             * @param [in] section The target section.
+             * @param [in] index The record's index, which must be less than Count(section).
+             * @return A copy of the record.
+             */
+        template<class Record>
+        [[nodiscard]] Record At(Section section, std::size_t index) const {
+            // Copy the bytes out, as the file does not guarantee the record's alignment
+            Record record;
+            std::memcpy(&record, data_ + header_.sections_[(std::size_t) section].offset_ + index * sizeof(Record),
+                        sizeof(Record));
+            return record;
+        }
+
+    private:
+            /// The first viewed byte.
+        const char* data_ = nullptr;
+
+            /// The amount of viewed bytes.
+        std::size_t size_ = 0;
+
+            /// A copy of the viewed header.
+        Header header_{};
+    };
+
+        /**
+         * @brief Encodes the databases into a binary knowledge base.
+         * Every string is stored once in a shared string table, and referred to by index from fixed-size records.
+         * @param [in] fact_database The Facts to encode.
+         * @param [in] rule_database The Rules to encode.
+         * @return The bytes of the binary knowledge base.
+         * @note Session values and Rule statistics are not stored, matching the JSON format.
+         */
+    std::vector<char> Encode(const facts::FactDatabase& fact_database, const rules::RuleDatabase& rule_database);
+
+        /**
+         * @brief Decodes a viewed binary knowledge base into the databases.
+         * @param [in] view The viewed binary knowledge base.
+         * @param [out] fact_database The decoded Facts.
+         * @param [out] rule_database The decoded Rules.
+         * @return kSuccess if every record was decoded, or kInvalidRecord otherwise.
+         * @note The databases are only replaced on success.
+         */
+    BinaryOutcome Decode(const KnowledgeView& view, facts::FactDatabase& fact_database,
+                         rules::RuleDatabase& rule_database);
+
+        /**
+         * @brief Checks if a file begins with kMagic.
+         * @param [in] file_name The name of the file.
+         * @return True if the file could be read and is a binary knowledge base, False otherwise.
+         */
+    bool IsBinaryFile(const std::string& file_name);
+
+        /**
+         * @brief Attempts to encode the databases into a binary knowledge base file.
+         * @param [in] file_name The name of the file to write.
+         * @param [in] fact_database The Facts to encode.
+         * @param [in] rule_database The Rules to encode.
+         * @return True if the file was written, False otherwise.
+         */
+    bool Save(const std::string& file_name, const facts::FactDatabase& fact_database,
+              const rules::RuleDatabase& rule_database);
+
+        /**
+         * @brief Attempts to map a binary knowledge base file into memory and decode it into the databases.
+         * @param [in] file_name The name of the file to read.
+         * @param [out] fact_database The decoded Facts.
+         * @param [out] rule_database The decoded Rules.
+         * @return kSuccess if the file was decoded, or the reason it could not be otherwise.
+         * @note The databases are only replaced on success.
+         */
+    BinaryOutcome Load(const std::string& file_name, facts::FactDatabase& fact_database,
+                       rules::RuleDatabase& rule_database);
+
+        /**
+         * @brief Converts an expert system from the JSON format into a binary knowledge base file.
+         * @param [in] json_store A JSON object with the JSON_ID_DATABASE_FACTS and JSON_ID_DATABASE_RULES entries.
+         * @param [in] file_name The name of the file to write.
+         * @return True if the file was written, False otherwise.
+         */
+    bool ConvertFromJSON(const nlohmann::json& json_store, const std::string& file_name);
+
+        /**
+         * @brief Converts a binary knowledge base file into the JSON format.
+         * @param [in] file_name The name of the file to read.
+         * @param [out] json_store A JSON object with the JSON_ID_DATABASE_FACTS and JSON_ID_DATABASE_RULES entries.
+         * @return kSuccess if the file was converted, or the reason it could not be otherwise.
+         */
+    BinaryOutcome ConvertToJSON(const std::string& file_name, nlohmann::json& json_store);
+
+} // namespace expert_system::knowledge::binary
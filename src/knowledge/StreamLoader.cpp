@@ -0,0 +1,437 @@
+#include "StreamLoader.hpp"
+
+#include <exception>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "utility/SymbolsJSON.hpp"
+
+namespace expert_system::knowledge::stream {
+
+    namespace {
+
+            /// The symbolic representations of the top-level entries being loaded.
+        enum class Section {
+            kNone,
+            kFacts,
+            kRules,
+            kSkipped
+        };
+
+            /**
+             * @brief Receives the JSON tokens of an expert system, converting each Fact and Rule as it ends.
+             * Values outside of the Fact and Rule databases are skipped without being stored.
+             */
+        class ExpertSystemHandler : public nlohmann::json_sax<nlohmann::json> {
+        public:
+                /**
+                 * @brief Parameterized constructor.
+                 * @param [in,out] fact_database The FactDatabase to store the Facts in.
+                 * @param [in,out] rule_database The RuleDatabase to store the Rules in, without indexing them.
+                 * @param [out] error The error to describe a failure with.
+                 */
+            ExpertSystemHandler(facts::FactDatabase& fact_database, rules::RuleDatabase& rule_database,
+                                LoadError& error)
+                : fact_database_(fact_database), rule_database_(rule_database), error_(error) {}
+
+            bool null() override {
+                return Value(nullptr);
+            }
+
+            bool boolean(bool value) override {
+                return Value(value);
+            }
+
+            bool number_integer(number_integer_t value) override {
+                return Value(value);
+            }
+
+            bool number_unsigned(number_unsigned_t value) override {
+                return Value(value);
+            }
+
+            bool number_float(number_float_t value, const string_t&) override {
+                return Value(value);
+            }
+
+            bool string(string_t& value) override {
+                return Value(std::move(value));
+            }
+
+            bool binary(binary_t& value) override {
+                return Value(nlohmann::json::binary(std::move(value)));
+            }
+
+            bool start_object(std::size_t) override {
+                return StartContainer(nlohmann::json::object());
+            }
+
+            bool key(string_t& value) override {
+                // Track the member being read
+                path_.back().key_ = std::move(value);
+                return true;
+            }
+
+            bool end_object() override {
+                return EndContainer();
+            }
+
+            bool start_array(std::size_t) override {
+                return StartContainer(nlohmann::json::array());
+            }
+
+            bool end_array() override {
+                return EndContainer();
+            }
+
+            bool parse_error(std::size_t position, const std::string&, const nlohmann::json::exception& ex) override {
+                // Report the syntax error where it was found
+                error_.path_ = Pointer();
+                error_.position_ = position;
+                error_.message_ = ex.what();
+                return false;
+            }
+
+                /**
+                 * @brief Checks that both databases were found once the input has ended.
+                 * @return True if the expert system was complete, False otherwise.
+                 */
+            bool Finish() {
+                // Catch a missing database
+                if (!found_facts_) {
+                    return Fail("/" + std::string(utility::JSON_ID_DATABASE_FACTS), "The Fact Database is missing");
+                }
+                if (!found_rules_) {
+                    return Fail("/" + std::string(utility::JSON_ID_DATABASE_RULES), "The Rule Database is missing");
+                }
+                return true;
+            }
+
+        private:
+                /// A container that is being read.
+            struct PathToken {
+                    /// True for an array, False for an object.
+                bool array_ = false;
+
+                    /// The key of the object member being read.
+                std::string key_;
+
+                    /// The amount of array elements that have started.
+                std::size_t elements_ = 0;
+            };
+
+                /**
+                 * @brief Describes a failure, and stops the parse.
+                 * @param [in] path The JSON Pointer of the value that could not be loaded.
+                 * @param [in] message A description of the problem.
+                 * @return Always False.
+                 */
+            bool Fail(std::string path, std::string message) {
+                error_.path_ = std::move(path);
+                error_.position_.reset();
+                error_.message_ = std::move(message);
+                return false;
+            }
+
+                /**
+                 * @brief Builds the JSON Pointer of the value being read.
+                 * @return The JSON Pointer, which is empty for the document itself.
+                 */
+            std::string Pointer() const {
+                // Append each container's current member, escaping the reserved characters
+                std::string pointer;
+                for (const auto& current_token: path_) {
+                    pointer += '/';
+                    if (current_token.array_) {
+                        pointer += std::to_string(current_token.elements_ == 0 ? 0 : current_token.elements_ - 1);
+                        continue;
+                    }
+                    for (auto current_char: current_token.key_) {
+                        if (current_char == '~') {
+                            pointer += "~0";
+                        } else if (current_char == '/') {
+                            pointer += "~1";
+                        } else {
+                            pointer += current_char;
+                        }
+                    }
+                }
+                return pointer;
+            }
+
+                /// Counts a new element of the array being read, so that the JSON Pointer points at it.
+            void CountElement() {
+                if (!path_.empty() && path_.back().array_) {
+                    path_.back().elements_++;
+                }
+            }
+
+                /**
+                 * @brief Handles a scalar value.
+                 * @param [in] value The value.
+                 * @return True to continue parsing, False to stop.
+                 */
+            bool Value(nlohmann::json value) {
+                // Catch a document that is not an object
+                CountElement();
+                if (path_.empty()) {
+                    return Fail("", "The expert system must be a JSON object");
+                }
+
+                // Split the logic based on the depth of the value
+                switch (path_.size()) {
+                    case 1: {
+                        // Catch a database that is not an object, and skip any other top-level value
+                        return CheckDatabaseMember(false);
+                    }
+                    case 2: {
+                        // A Fact or Rule with a scalar value, which is converted immediately
+                        if (section_ == Section::kSkipped) {
+                            return true;
+                        }
+                        entity_ = std::move(value);
+                        return StoreEntity();
+                    }
+                    default: {
+                        // Part of a Fact or Rule
+                        if (section_ == Section::kSkipped) {
+                            return true;
+                        }
+                        Insert(std::move(value));
+                        return true;
+                    }
+                }
+            }
+
+                /**
+                 * @brief Handles the start of an object or array.
+                 * @param [in] container An empty object or array.
+                 * @return True to continue parsing, False to stop.
+                 */
+            bool StartContainer(nlohmann::json container) {
+                // Split the logic based on the depth of the container
+                CountElement();
+                bool is_array = container.is_array();
+                switch (path_.size()) {
+                    case 0: {
+                        // Catch a document that is not an object
+                        if (is_array) {
+                            return Fail("", "The expert system must be a JSON object");
+                        }
+                        break;
+                    }
+                    case 1: {
+                        // Select the database being read, skipping any other top-level value
+                        if (!CheckDatabaseMember(!is_array)) {
+                            return false;
+                        }
+                        if (is_array) {
+                            section_ = Section::kSkipped;
+                        } else if (path_.back().key_ == utility::JSON_ID_DATABASE_FACTS) {
+                            section_ = Section::kFacts;
+                        } else if (path_.back().key_ == utility::JSON_ID_DATABASE_RULES) {
+                            section_ = Section::kRules;
+                        } else {
+                            section_ = Section::kSkipped;
+                        }
+                        break;
+                    }
+                    case 2: {
+                        // Start building a Fact or Rule
+                        if (section_ != Section::kSkipped) {
+                            entity_ = std::move(container);
+                            builder_stack_.push_back(&entity_);
+                        }
+                        break;
+                    }
+                    default: {
+                        // Continue building a Fact or Rule
+                        if (section_ != Section::kSkipped) {
+                            builder_stack_.push_back(&Insert(std::move(container)));
+                        }
+                        break;
+                    }
+                }
+
+                // Track the container
+                PathToken new_token;
+                new_token.array_ = is_array;
+                path_.push_back(std::move(new_token));
+                return true;
+            }
+
+                /**
+                 * @brief Handles the end of an object or array.
+                 * @return True to continue parsing, False to stop.
+                 */
+            bool EndContainer() {
+                // Stop tracking the container
+                path_.pop_back();
+
+                // Split the logic based on the depth of the container
+                switch (path_.size()) {
+                    case 1: {
+                        // A database has ended
+                        if (section_ == Section::kFacts) {
+                            found_facts_ = true;
+                        } else if (section_ == Section::kRules) {
+                            found_rules_ = true;
+                        }
+                        section_ = Section::kNone;
+                        return true;
+                    }
+                    case 2: {
+                        // A Fact or Rule has ended, convert it
+                        if (section_ == Section::kSkipped) {
+                            return true;
+                        }
+                        builder_stack_.pop_back();
+                        return StoreEntity();
+                    }
+                    default: {
+                        // Part of a Fact or Rule has ended
+                        if (!builder_stack_.empty()) {
+                            builder_stack_.pop_back();
+                        }
+                        return true;
+                    }
+                }
+            }
+
+                /**
+                 * @brief Checks that a top-level member of the document is an object if it is one of the databases.
+                 * @param [in] is_object True if the member's value is an object, False otherwise.
+                 * @return True if the member can be read, False otherwise.
+                 */
+            bool CheckDatabaseMember(bool is_object) {
+                // Only the databases have a required type
+                const auto& member_key = path_.back().key_;
+                if (is_object || (member_key != utility::JSON_ID_DATABASE_FACTS
+                                  && member_key != utility::JSON_ID_DATABASE_RULES)) {
+                    return true;
+                }
+                return Fail(Pointer(), "The database must be a JSON object");
+            }
+
+                /**
+                 * @brief Adds a value to the innermost container of the Fact or Rule being built.
+                 * @param [in] value The value to add.
+                 * @return A reference to the stored value.
+                 */
+            nlohmann::json& Insert(nlohmann::json value) {
+                // Append to an array, or assign to the object member being read
+                auto& target = *builder_stack_.back();
+                if (target.is_array()) {
+                    target.push_back(std::move(value));
+                    return target.back();
+                }
+                auto& member = target[path_.back().key_];
+                member = std::move(value);
+                return member;
+            }
+
+                /**
+                 * @brief Converts the finished Fact or Rule, and stores it.
+                 * @return True if it was converted, False otherwise.
+                 */
+            bool StoreEntity() {
+                // Convert the value, catching the errors thrown by invalid values
+                const auto& entity_name = path_.back().key_;
+                try {
+                    if (section_ == Section::kFacts) {
+                        // Replace a Fact with a repeated name, matching the JSON object's semantics
+                        auto parsed_fact = entity_.get<facts::VariantFact>();
+                        auto existing_fact = fact_database_.Find(entity_name);
+                        if (existing_fact.has_value()) {
+                            existing_fact->get() = std::move(parsed_fact);
+                        } else {
+                            fact_database_.Create(entity_name, parsed_fact.type_)->get() = std::move(parsed_fact);
+                        }
+                    } else {
+                        // Replace a Rule with a repeated name, matching the JSON object's semantics
+                        rule_database_.managed_rules_.insert_or_assign(entity_name, entity_.get<rules::Rule>());
+                    }
+                } catch (const std::exception& ex) {
+                    return Fail(Pointer(), ex.what());
+                }
+
+                // Discard the JSON form
+                entity_ = nullptr;
+                return true;
+            }
+
+                /// The FactDatabase to store the Facts in.
+            facts::FactDatabase& fact_database_;
+
+                /// The RuleDatabase to store the Rules in.
+            rules::RuleDatabase& rule_database_;
+
+                /// The error to describe a failure with.
+            LoadError& error_;
+
+                /// The containers being read, from the document inwards.
+            std::vector<PathToken> path_;
+
+                /// The database being read.
+            Section section_ = Section::kNone;
+
+                /// The JSON form of the Fact or Rule being built.
+            nlohmann::json entity_;
+
+                /// The open containers of the Fact or Rule being built, from the outermost inwards.
+            std::vector<nlohmann::json*> builder_stack_;
+
+                /// True once the Fact Database has been read.
+            bool found_facts_ = false;
+
+                /// True once the Rule Database has been read.
+            bool found_rules_ = false;
+        };
+
+    } // namespace
+
+    std::string LoadError::Describe() const {
+        // Combine the location and the message
+        std::string description = path_.empty() ? std::string("/") : path_;
+        if (position_.has_value()) {
+            description += " (byte " + std::to_string(position_.value()) + ")";
+        }
+        return description + ": " + message_;
+    }
+
+    bool Load(std::istream& input, facts::FactDatabase& fact_database, rules::RuleDatabase& rule_database,
+              LoadError& error) {
+        // Parse the input into new databases
+        facts::FactDatabase new_facts;
+        rules::RuleDatabase new_rules;
+        ExpertSystemHandler handler(new_facts, new_rules, error);
+        if (!nlohmann::json::sax_parse(input, &handler) || !handler.Finish()) {
+            return false;
+        }
+
+        // Build the Rules' Fact dependency index once, and replace the databases
+        new_rules.Reindex();
+        fact_database = std::move(new_facts);
+        rule_database = std::move(new_rules);
+        return true;
+    }
+
+    bool Load(const std::string& file_name, facts::FactDatabase& fact_database, rules::RuleDatabase& rule_database,
+              LoadError& error) {
+        // Attempt to open the requested file
+        std::ifstream file_stream(file_name, std::ifstream::in | std::ifstream::binary);
+        if (!file_stream.is_open()) {
+            error.path_.clear();
+            error.position_.reset();
+            error.message_ = "Unable to open file \"" + file_name + "\"";
+            return false;
+        }
+
+        // Stream the file's contents
+        return Load(file_stream, fact_database, rule_database, error);
+    }
+
+} // namespace expert_system::knowledge::stream
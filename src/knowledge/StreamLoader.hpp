@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <istream>
+#include <optional>
+#include <string>
+
+#include "knowledge/facts/FactDatabase.hpp"
+#include "knowledge/rules/RuleDatabase.hpp"
+
+namespace expert_system::knowledge::stream {
+
+        /// A description of why an expert system could not be loaded.
+    struct LoadError {
+            /// The JSON Pointer of the value that could not be loaded, such as "/database_rules/R001".
+        std::string path_;
+
+            /// The byte offset of a syntax error, or std::nullopt for a value that could not be converted.
+        std::optional<std::size_t> position_;
+
+            /// A description of the problem.
+        std::string message_;
+
+            /**
+             * @brief Formats the error for display.
+             * @return The path, the byte offset if there is one, and the message.
+             */
+        [[nodiscard]] std::string Describe() const;
+    };
+
+        /**
+         * @brief Loads an expert system saved in the JSON format, without building a document of the whole input.
+         * The input is parsed as a stream of tokens, and each Fact and Rule is converted as soon as its value ends,
+         * so that only one Fact or Rule is held in JSON form at a time.
+         * @param [in] input The stream to read the JSON object from.
+         * @param [out] fact_database The loaded Facts.
+         * @param [out] rule_database The loaded Rules.
+         * @param [out] error The reason the expert system could not be loaded, only assigned on failure.
+         * @return True if the expert system was loaded, False otherwise.
+         * @note The databases are only replaced on success.
+         * @note Facts are created in the order they appear, and a repeated name replaces the earlier entry.
+         */
+    bool Load(std::istream& input, facts::FactDatabase& fact_database, rules::RuleDatabase& rule_database,
+              LoadError& error);
+
+        /**
+         * @brief Loads an expert system from a file saved in the JSON format, see Load().
+         * @param [in] file_name The name of the file.
+         * @param [out] fact_database The loaded Facts.
+         * @param [out] rule_database The loaded Rules.
+         * @param [out] error The reason the expert system could not be loaded, only assigned on failure.
+         * @return True if the expert system was loaded, False otherwise.
+         */
+    bool Load(const std::string& file_name, facts::FactDatabase& fact_database, rules::RuleDatabase& rule_database,
+              LoadError& error);
+
+} // namespace expert_system::knowledge::stream
@@ -3,7 +3,6 @@
 #include <optional>
 #include <string>
 
-#include "knowledge/facts/Value.hpp"
 #include "utility/Range.hpp"
 
 namespace expert_system::knowledge::facts {
@@ -11,16 +10,17 @@ namespace expert_system::knowledge::facts {
         /**
          * @brief Template Fact.
          * @tparam T The raw type of the Fact.
+         * @note Session values are stored separately, see FactDatabase::SetValue().
          */
     template<class T>
     class Fact {
     public:
             /**
              * Default constructor.
-             * Assigns std::nullopt to all optional members.
+             * Assigns std::nullopt to the Fact's Range.
              * Assigns an empty string to the Fact's description.
              */
-        Fact() : range_(std::nullopt), value_(std::nullopt) {};
+        Fact() : range_(std::nullopt) {};
 
             /**
              * @brief Assigns a Range to the Fact.
@@ -28,16 +28,11 @@ namespace expert_system::knowledge::facts {
              * @param [in] min The Range's minimum value.
              * @param [in] max The Range's maximum value.
              * @param [in] bounds_inclusive Flag for including the bounds of the Range.
-             * @return True if the Range is valid and no session value is assigned, False otherwise.
+             * @return True if the Range is valid, False otherwise.
              * @note The Fact's Range will not be modified if this returns False.
+             * @warning Session values are stored separately, use FactDatabase::SetRange() to protect them from the new Range!
              */
         bool SetRange(T min, T max, bool bounds_inclusive) {
-            // Catch a session value existing
-            if (value_.has_value()) {
-                // Catch possible invalidation of session value and stop
-                return false;
-            }
-
             // Check if the proposed range minimum is larger than the maximum
             if (max < min) {
                 // Catch invalid range and stop
@@ -54,7 +49,7 @@ namespace expert_system::knowledge::facts {
              * @return A copy of range_.
              * @note If the Fact has no Range, this will return std::nullopt.
              */
-        std::optional<utility::Range<T>> GetRange() {
+        std::optional<utility::Range<T>> GetRange() const {
             // Just return a copy of range_, not the contents inside of it.
             return range_;
         };
@@ -94,66 +89,11 @@ namespace expert_system::knowledge::facts {
              * @brief Gathers the Fact's description.
              * @return A copy of description_.
              */
-        std::string GetDescription() {
+        std::string GetDescription() const {
             // Simply provide a copy of the stored string
             return description_;
         };
 
-            /**
-             * @brief Assigns a session value to the Fact through a filter.
-             * This prevents values outside of the Fact's range from being assigned.
-             * If a value is already assigned, new values will be discarded if they have a lower confidence factor.
-             * @param [in] value The session value for the Fact.
-             * @param [in] confidence_factor A specifier of the session value's confidence factor.
-             * @return True if the provided value is assigned, False otherwise.
-             */
-        bool SetValue(T value, utility::Confidence& confidence_factor) {
-            // Check if the Fact has an assigned range
-            if (range_.has_value()) {
-                // Check if the provided value is not valid
-                if (!utility::Range<T>::InRange(range_.value(), value)) {
-                    // Catch an invalid value and stop
-                    return false;
-                }
-            }
-
-            // Catch if the Fact already has a value
-            if (value_.has_value()) {
-                // Stop the assignment if the new value has a lower confidence value
-                if (confidence_factor < value_.value().confidence_factor_) {
-                    // Catch the less confident value and stop
-                    return false;
-                }
-
-                // Assign the new value and indicate success
-                value_.emplace(value, confidence_factor);
-                return true;
-            }
-
-            // Assign the new value and indicate success
-            value_.emplace(value, confidence_factor);
-            return true;
-        };
-
-            /**
-             * @brief Gather a copy of the Fact's session value.
-             * @return A copy of value_.
-             * @note If the Fact has no session value, this will return std::nullopt.
-             */
-        std::optional<knowledge::facts::Value<T>> GetValue() {
-            // Just return a copy of value_.
-            return value_;
-        };
-
-            /**
-             * @brief Removes the Fact's session value.
-             * @note This will have no effect if the fact does not have a session value assigned.
-             */
-        void ClearValue() {
-            // Destroy the contents of the value_ member.
-            value_.reset();
-        };
-
     private:
             /**
              * @brief The Fact's Range.
@@ -166,12 +106,6 @@ namespace expert_system::knowledge::facts {
              * May be completely empty.
              */
         std::string description_;
-
-            /**
-             * @brief The Fact's session value.
-             * Contains the Fact's raw value and metadata.
-             */
-        std::optional<knowledge::facts::Value<T>> value_;
     };
 
 }// namespace expert_system::knowledge::facts
@@ -1,181 +1,584 @@
 #include "FactDatabase.hpp"
 
+#include <atomic>
 #include <tuple>
+#include <utility>
+
+#include "utility/SymbolsJSON.hpp"
 
 namespace expert_system::knowledge::facts {
 
+    namespace {
+
+            /**
+             * @brief Issues a new process-unique FactDatabase identity.
+             * @return The identity, which is never 0.
+             */
+        std::uint64_t NextIdentity() {
+            static std::atomic<std::uint64_t> identity_counter(0);
+            return ++identity_counter;
+        }
+
+    } // namespace
+
+    FactDatabase::FactDatabase()
+        : storage_(std::make_shared<Storage>()) {
+        // Take a new identity for the empty Facts
+        storage_->identity_ = NextIdentity();
+    }
+
+    FactDatabase::FactDatabase(const FactDatabase& target)
+        : storage_(std::make_shared<Storage>(*target.storage_)),
+          session_values_(target.session_values_) {
+        // Take a new identity for the copied Facts
+        storage_->identity_ = NextIdentity();
+    }
+
+    FactDatabase& FactDatabase::operator=(const FactDatabase& target) {
+        // Copy the Facts, but take a new identity
+        storage_ = std::make_shared<Storage>(*target.storage_);
+        storage_->identity_ = NextIdentity();
+        session_values_ = target.session_values_;
+        return *this;
+    }
+
+    FactDatabase::FactDatabase(FactDatabase&& target)
+        : storage_(std::move(target.storage_)),
+          session_values_(std::move(target.session_values_)) {
+        // Leave the target empty with a new identity, so the handles it issued can't be reissued
+        target.storage_ = std::make_shared<Storage>();
+        target.storage_->identity_ = NextIdentity();
+        target.session_values_ = SessionStore();
+    }
+
+    FactDatabase& FactDatabase::operator=(FactDatabase&& target) {
+        // Take the moved Facts along with their identity
+        storage_ = std::move(target.storage_);
+        session_values_ = std::move(target.session_values_);
+
+        // Leave the target empty with a new identity, so the handles it issued can't be reissued
+        target.storage_ = std::make_shared<Storage>();
+        target.storage_->identity_ = NextIdentity();
+        target.session_values_ = SessionStore();
+        return *this;
+    }
+
+    FactDatabase FactDatabase::Fork() const {
+        // Share the Facts and the session value pages, along with the identity
+        FactDatabase branch;
+        branch.storage_ = storage_;
+        branch.session_values_ = session_values_;
+        return branch;
+    }
+
+    bool FactDatabase::Shared() const {
+        // Check if a fork still refers to the Facts
+        return storage_.use_count() != 1;
+    }
+
+    void FactDatabase::Detach() {
+        // Catch if no fork refers to the Facts
+        if (!Shared()) {
+            return;
+        }
+
+        // Copy the Facts, and take a new identity as their handles may now diverge from the forks
+        storage_ = std::make_shared<Storage>(*storage_);
+        storage_->identity_ = NextIdentity();
+    }
+
     std::optional<std::reference_wrapper<VariantFact>> FactDatabase::Create(
             const std::string& name, utility::ExpertSystemTypes type) {
         // Catch if the name is already used
-        if (stored_facts_.find(name) != stored_facts_.end()) {
+        Detach();
+        if (storage_->fact_handles_.find(name) != storage_->fact_handles_.end()) {
             // Stop and indicate failure
             return std::nullopt;
         }
 
-        // Create the Fact
-        stored_facts_.insert(std::pair<std::string, VariantFact>(name, type));
+        // Create the Fact with a new handle
+        auto handle = (FactHandle) storage_->stored_facts_.size();
+        storage_->stored_facts_.emplace_back(VariantFact(type));
+        session_values_.Resize(storage_->stored_facts_.size());
+        storage_->stored_handles_.Resize(storage_->stored_facts_.size());
+        storage_->stored_handles_.Set(handle);
+        storage_->handle_names_.push_back(name);
+        storage_->fact_handles_.emplace(name, handle);
 
-        // Attempt to gather a reference to the Fact
-        return Find(name);
+        // Gather a reference to the Fact
+        return storage_->stored_facts_.back().value();
     }
 
     std::optional<std::reference_wrapper<VariantFact>> FactDatabase::Find(
             const std::string& name) {
+        // Count the lookup
+        utility::Count(utility::Counter::kFactLookups);
+
+        // Take a private copy of the Facts, as the reference may be used to change the Fact
+        Detach();
+
         // Catch an invalid/unused Fact name
-        if (stored_facts_.find(name) == stored_facts_.end()) {
+        auto search_result = storage_->fact_handles_.find(name);
+        if (search_result == storage_->fact_handles_.end()) {
+            // Stop and indicate failure
+            return std::nullopt;
+        }
+
+        // Gather a reference to the Fact
+        return storage_->stored_facts_[search_result->second].value();
+    }
+
+    std::optional<std::reference_wrapper<VariantFact>> FactDatabase::Find(FactHandle handle) {
+        // Count the lookup
+        utility::Count(utility::Counter::kFactLookups);
+
+        // Take a private copy of the Facts, as the reference may be used to change the Fact
+        Detach();
+
+        // Catch an invalid handle, or a deleted Fact
+        if ((handle >= storage_->stored_facts_.size()) || !storage_->stored_facts_[handle].has_value()) {
             // Stop and indicate failure
             return std::nullopt;
         }
 
         // Gather a reference to the Fact
-        return stored_facts_[name];
+        return storage_->stored_facts_[handle].value();
+    }
+
+    std::optional<std::reference_wrapper<const VariantFact>> FactDatabase::Find(FactHandle handle) const {
+        // Count the lookup
+        utility::Count(utility::Counter::kFactLookups);
+
+        // Catch an invalid handle, or a deleted Fact
+        if ((handle >= storage_->stored_facts_.size()) || !storage_->stored_facts_[handle].has_value()) {
+            // Stop and indicate failure
+            return std::nullopt;
+        }
+
+        // Gather a const reference to the Fact
+        return storage_->stored_facts_[handle].value();
+    }
+
+    std::optional<std::reference_wrapper<const VariantFact>> FactDatabase::Find(
+            const std::string& name, FactBinding& binding) const {
+        // Count the lookup
+        utility::Count(utility::Counter::kFactLookups);
+
+        // Look up the name if the cached handle was not issued for these Facts, caching the handle for the next lookup
+        const auto& stored_facts = storage_->stored_facts_;
+        if ((binding.database_ != storage_->identity_)
+            || (binding.handle_ >= stored_facts.size())
+            || !stored_facts[binding.handle_].has_value()) {
+            binding = Bind(name);
+        }
+
+        // Catch an invalid handle, or a deleted Fact
+        if ((binding.handle_ >= stored_facts.size()) || !stored_facts[binding.handle_].has_value()) {
+            // Stop and indicate failure
+            return std::nullopt;
+        }
+
+        // Gather a const reference to the Fact
+        return stored_facts[binding.handle_].value();
+    }
+
+    std::optional<FactHandle> FactDatabase::Handle(const std::string& name) const {
+        // Catch an invalid/unused Fact name
+        auto search_result = storage_->fact_handles_.find(name);
+        if (search_result == storage_->fact_handles_.end()) {
+            // Stop and indicate failure
+            return std::nullopt;
+        }
+
+        // Return the interned handle
+        return search_result->second;
+    }
+
+    FactBinding FactDatabase::Bind(const std::string& name) const {
+        // Catch an invalid/unused Fact name
+        FactBinding binding;
+        auto handle = Handle(name);
+        if (!handle.has_value()) {
+            // Indicate failure with an unbound binding
+            return binding;
+        }
+
+        // Bind the handle to this database
+        binding.handle_ = handle.value();
+        binding.database_ = storage_->identity_;
+        return binding;
     }
 
     bool FactDatabase::Known(const std::string& name) {
-        // Attempt to Find the requested Fact
-        auto target_fact = Find(name);
-        if (target_fact == std::nullopt) {
+        // Attempt to gather the requested Fact's handle
+        auto search_result = storage_->fact_handles_.find(name);
+        if (search_result == storage_->fact_handles_.end()) {
             // Catch an invalid Fact and indicate failure
             return false;
         }
 
-        // Check if the Fact has a session value
-        switch (target_fact->get().type_) {
+        // Check the session value store
+        return Known(search_result->second);
+    }
+
+    bool FactDatabase::Known(FactHandle handle) const {
+        // Check the session value store, deleted Facts never have a session value
+        return session_values_.Known(handle);
+    }
+
+    VariantValue FactDatabase::GetVariantValue(const std::string& name) const {
+        // Catch an invalid Fact, or a Fact without a session value
+        VariantValue gathered_value;
+        auto search_result = storage_->fact_handles_.find(name);
+        if ((search_result == storage_->fact_handles_.end()) || !Known(search_result->second)) {
+            // Indicate failure with an unknown value
+            return gathered_value;
+        }
+
+        // Split the logic based on the Fact's type
+        auto handle = search_result->second;
+        const auto& found_fact = storage_->stored_facts_[handle].value();
+        switch (found_fact.type_) {
             case utility::ExpertSystemTypes::kBool: {
-                // Gather the raw data and check if the session value exists
-                auto raw_fact = std::get<BoolFact>(target_fact->get().fact_);
-                return (raw_fact.GetValue().has_value());
+                // Copy the stored Value
+                gathered_value.value_ = session_values_.Load<bool>(handle).value();
+                break;
             }
             case utility::ExpertSystemTypes::kInt: {
-                // Gather the raw data and check if the session value exists
-                auto raw_fact = std::get<IntFact>(target_fact->get().fact_);
-                return (raw_fact.GetValue().has_value());
+                // Copy the stored Value
+                gathered_value.value_ = session_values_.Load<int>(handle).value();
+                break;
             }
             case utility::ExpertSystemTypes::kFloat: {
-                // Gather the raw data and check if the session value exists
-                auto raw_fact = std::get<FloatFact>(target_fact->get().fact_);
-                return (raw_fact.GetValue().has_value());
+                // Copy the stored Value
+                gathered_value.value_ = session_values_.Load<float>(handle).value();
+                break;
             }
             case utility::ExpertSystemTypes::kEnum: {
-                // Gather the raw data and check if the session value exists
-                auto raw_fact = std::get<EnumFact>(target_fact->get().fact_);
-                return (raw_fact.fact_.GetValue().has_value());
+                // Copy the stored Value, along with the enum used to convert it
+                gathered_value.value_ = EnumValue(std::get<EnumFact>(found_fact.fact_).enum_,
+                                                  session_values_.Load<int>(handle).value());
+                break;
+            }
+            default: {
+                // Don't store any data
+                return gathered_value;
+            }
+        }
+
+        // Store the type
+        gathered_value.type_ = found_fact.type_;
+        return gathered_value;
+    }
+
+    void FactDatabase::ClearValue(FactHandle handle) {
+        // Clear the handle's session value
+        session_values_.Clear(handle);
+    }
+
+    bool FactDatabase::InsertEnumValue(const std::string& fact_name, const std::string& enum_name, int position) {
+        // Insert the enum value, moving the enum values after it
+        return EditEnum(fact_name, [&](utility::DynamicEnum& fact_enum) {
+            return fact_enum.Insert(enum_name, position);
+        });
+    }
+
+    bool FactDatabase::RemoveEnumValue(const std::string& fact_name, const std::string& enum_name) {
+        // Remove the enum value, moving the enum values after it
+        return EditEnum(fact_name, [&](utility::DynamicEnum& fact_enum) {
+            return fact_enum.Remove(enum_name);
+        });
+    }
+
+    bool FactDatabase::EditEnum(const std::string& fact_name,
+                                const std::function<bool(utility::DynamicEnum&)>& edit) {
+        // Catch if the Fact does not exist, or is not an enum Fact
+        auto found_fact = Find(fact_name);
+        if (!found_fact.has_value() || (found_fact->get().type_ != utility::ExpertSystemTypes::kEnum)) {
+            return false;
+        }
+        auto handle = storage_->fact_handles_.at(fact_name);
+        auto& raw_fact = std::get<EnumFact>(found_fact->get().fact_);
+
+        // Identify the enum values of the session value and Range, which keep their EnumIds through the edit
+        auto session_value = session_values_.Load<int>(handle);
+        std::optional<utility::EnumId> value_id;
+        if (session_value.has_value()) {
+            value_id = raw_fact.enum_.Id(session_value->value_);
+        }
+        auto fact_range = raw_fact.fact_.GetRange();
+        std::optional<utility::EnumId> min_id;
+        std::optional<utility::EnumId> max_id;
+        if (fact_range.has_value()) {
+            min_id = raw_fact.enum_.Id(fact_range->min_);
+            max_id = raw_fact.enum_.Id(fact_range->max_);
+        }
+
+        // Catch if the edit made no change
+        if (!edit(raw_fact.enum_)) {
+            return false;
+        }
+
+        // Move the session value to its enum value's new position, or clear it if the enum value was removed
+        if (session_value.has_value()) {
+            auto new_position = raw_fact.enum_.Position(value_id.value_or(utility::kInvalidEnumId));
+            if (new_position.has_value()) {
+                session_value->value_ = new_position.value();
+                session_values_.Store<int>(handle, session_value.value());
+            } else {
+                session_values_.Clear(handle);
             }
-            default:
-                // Indicate failure
-                return false;
         }
+
+        // Move the Range's bounds in the same way, clearing it if either bound was removed
+        if (fact_range.has_value()) {
+            auto new_min = raw_fact.enum_.Position(min_id.value_or(utility::kInvalidEnumId));
+            auto new_max = raw_fact.enum_.Position(max_id.value_or(utility::kInvalidEnumId));
+            if (new_min.has_value() && new_max.has_value()) {
+                raw_fact.fact_.SetRange(new_min.value(), new_max.value(), fact_range->bounds_inclusive_);
+            } else {
+                raw_fact.fact_.ClearRange();
+            }
+        }
+
+        // Indicate success
+        return true;
+    }
+
+    const SessionStore& FactDatabase::SessionValues() const {
+        // Provide read access to the store
+        return session_values_;
     }
 
     std::set<std::string> FactDatabase::List(FactFilter filter) {
         // Create a temporary list to store the Fact names in
         std::set<std::string> fact_names;
 
-        // Iterate through the database's keys
-        for (const auto& map_iterator: stored_facts_) {
-            // Split the logic based on the specified filter
-            switch (filter) {
-                case FactFilter::kAll: {
-                    // Append the name to the end of the list
-                    fact_names.insert(map_iterator.first);
-                    break;
-                }
-                case FactFilter::kHasValue: {
-                    // Check if the Fact has a value
-                    if (Known(map_iterator.first)) {
-                        // Append the name to the end of the list
-                        fact_names.insert(map_iterator.first);
-                    }
-                    break;
-                }
-                case FactFilter::kHasNoValue: {
-                    // Check if the Fact has no value
-                    if (!Known(map_iterator.first)) {
-                        // Append the name to the end of the list
-                        fact_names.insert(map_iterator.first);
-                    }
-                    break;
-                }
-                default : {
-                    // Skip this Fact
-                    break;
-                }
-            }
-        }
+        // Iterate through the handles that pass the filter, and append their names to the list
+        IterateHandles(filter, [&](FactHandle handle) {
+            fact_names.insert(storage_->handle_names_[handle]);
+        });
 
         // Return the list of Fact names
         return fact_names;
     }
 
     int FactDatabase::Count() {
-        // Return the amount of elements in the map
-        return (int) stored_facts_.size();
+        // Return the amount of names in the map, deleted Facts have no name
+        return (int) storage_->fact_handles_.size();
+    }
+
+    std::size_t FactDatabase::CountKnown() const {
+        // Provide the running count, deleted Facts never have a session value
+        return session_values_.CountKnown();
+    }
+
+    std::size_t FactDatabase::CountUnknown() const {
+        // Discount the known Facts from the stored Facts
+        return storage_->stored_handles_.Count() - session_values_.CountKnown();
+    }
+
+    bool FactDatabase::AnyUnknown() const {
+        // Compare the running counts
+        return CountUnknown() != 0;
+    }
+
+    std::optional<std::reference_wrapper<const std::string>> FactDatabase::Name(FactHandle handle) const {
+        // Catch an invalid handle, or a deleted Fact
+        if (!storage_->stored_handles_.Test(handle)) {
+            // Stop and indicate failure
+            return std::nullopt;
+        }
+
+        // Gather a reference to the name
+        return storage_->handle_names_[handle];
     }
 
     bool FactDatabase::Remove(const std::string& name) {
         // Catch if the name is currently used
-        if (stored_facts_.find(name) == stored_facts_.end()) {
+        Detach();
+        auto search_result = storage_->fact_handles_.find(name);
+        if (search_result == storage_->fact_handles_.end()) {
             // Stop and indicate failure
             return false;
         }
 
-        // Delete the Fact with the specified name
-        stored_facts_.erase(name);
+        // Delete the Fact with the specified name, leaving its handle unused
+        storage_->stored_facts_[search_result->second].reset();
+        session_values_.Clear(search_result->second);
+        storage_->stored_handles_.Reset(search_result->second);
+        storage_->handle_names_[search_result->second].clear();
+        storage_->fact_handles_.erase(search_result);
         return true;
     }
 
     void FactDatabase::Clear() {
-        // Just empty the entire contents of the map
-        stored_facts_.clear();
+        // Delete every Fact, leaving their handles unused
+        Detach();
+        for (auto& current_fact: storage_->stored_facts_) {
+            current_fact.reset();
+        }
+        session_values_.ClearAll();
+        storage_->stored_handles_.ResetAll();
+        for (auto& current_name: storage_->handle_names_) {
+            current_name.clear();
+        }
+        storage_->fact_handles_.clear();
     }
 
     void FactDatabase::Reset() {
+        // Clear every session value, the Facts themselves are untouched
+        session_values_.ClearAll();
+    }
+
+    void FactDatabase::Iterate(const FactIteratingFunction& iterating_function) {
+        // Take a private copy of the Facts, as the function may change them
+        Detach();
+
         // Iterate through the map's contents
-        for (auto map_iterator: stored_facts_) {
+        for (auto& map_iterator: storage_->fact_handles_) {
+            // Pass the current Fact to the function
+            iterating_function(map_iterator.first, storage_->stored_facts_[map_iterator.second].value());
+        }
+    }
+
+    void FactDatabase::IterateHandles(FactFilter filter, const HandleIteratingFunction& iterating_function) const {
+        // Split the logic based on the specified filter
+        switch (filter) {
+            case FactFilter::kAll: {
+                // Visit every stored handle
+                storage_->stored_handles_.ForEach([&](std::size_t handle) {
+                    iterating_function((FactHandle) handle);
+                });
+                break;
+            }
+            case FactFilter::kHasValue: {
+                // Visit the known handles, which are always stored
+                session_values_.KnownHandles().ForEach([&](std::size_t handle) {
+                    iterating_function((FactHandle) handle);
+                });
+                break;
+            }
+            case FactFilter::kHasNoValue: {
+                // Visit the stored handles that are not known
+                storage_->stored_handles_.ForEachExcept(session_values_.KnownHandles(), [&](std::size_t handle) {
+                    iterating_function((FactHandle) handle);
+                });
+                break;
+            }
+            default: {
+                // Skip every Fact
+                break;
+            }
+        }
+    }
+
+    std::set<std::string> FactDatabase::ImportValues(const nlohmann::json& json_values) {
+        // Keep track of the Facts that could not be assigned
+        std::set<std::string> rejected_facts;
+
+        // Catch if the provided data is not an object
+        if (!json_values.is_object()) {
+            // Nothing can be imported
+            return rejected_facts;
+        }
+
+        // Iterate through the provided session values
+        for (const auto& current_entry: json_values.items()) {
+            // Catch an unknown Fact or incomplete data
+            auto search_result = storage_->fact_handles_.find(current_entry.key());
+            const auto& entry_data = current_entry.value();
+            if ((search_result == storage_->fact_handles_.end())
+                || !entry_data.is_object()
+                || (entry_data.find(utility::JSON_ID_VALUE) == entry_data.end())
+                || (entry_data.find(utility::JSON_ID_CONFIDENCE) == entry_data.end())
+                || !entry_data.at(utility::JSON_ID_CONFIDENCE).is_number()) {
+                // Reject the entry and skip it
+                rejected_facts.insert(current_entry.key());
+                continue;
+            }
+
+            // Gather the provided data
+            const auto& raw_json_value = entry_data.at(utility::JSON_ID_VALUE);
+            utility::Confidence confidence_factor(entry_data.at(utility::JSON_ID_CONFIDENCE).get<float>());
+
             // Split logic for each Fact type, assume the stored hint is correct
-            switch (map_iterator.second.type_) {
+            bool assigned = false;
+            auto handle = search_result->second;
+            const auto& found_fact = storage_->stored_facts_[handle].value();
+            switch (found_fact.type_) {
                 case utility::ExpertSystemTypes::kBool: {
-                    // Gather a reference to the Fact and clear its session data
-                    std::get<BoolFact>(map_iterator.second.fact_).ClearValue();
+                    // Check the type of the provided data and attempt to assign it
+                    if (raw_json_value.is_boolean()) {
+                        assigned = SetValue<bool>(handle, raw_json_value.get<bool>(), confidence_factor);
+                    }
                     break;
                 }
                 case utility::ExpertSystemTypes::kInt: {
-                    // Gather a reference to the Fact and clear its session data
-                    std::get<IntFact>(map_iterator.second.fact_).ClearValue();
+                    // Check the type of the provided data and attempt to assign it
+                    if (raw_json_value.is_number_integer()) {
+                        assigned = SetValue<int>(handle, raw_json_value.get<int>(), confidence_factor);
+                    }
                     break;
                 }
                 case utility::ExpertSystemTypes::kFloat: {
-                    // Gather a reference to the Fact and clear its session data
-                    std::get<FloatFact>(map_iterator.second.fact_).ClearValue();
+                    // Check the type of the provided data and attempt to assign it
+                    if (raw_json_value.is_number()) {
+                        assigned = SetValue<float>(handle, raw_json_value.get<float>(), confidence_factor);
+                    }
                     break;
                 }
                 case utility::ExpertSystemTypes::kEnum: {
-                    // Gather a reference to the Fact and clear its session data
-                    std::get<EnumFact>(map_iterator.second.fact_).fact_.ClearValue();
+                    // Check the type of the provided data and convert it to an enum value
+                    const auto& raw_fact = std::get<EnumFact>(found_fact.fact_);
+                    if (raw_json_value.is_string()) {
+                        auto enum_position = raw_fact.enum_.At(raw_json_value.get<std::string>());
+                        if (enum_position.has_value()) {
+                            // Attempt to assign the enum value
+                            assigned = SetValue<int>(handle, enum_position.value(), confidence_factor);
+                        }
+                    }
                     break;
                 }
                 default:
                     break;
             }
-        }
-    }
 
-    void FactDatabase::Iterate(const FactIteratingFunction& iterating_function) {
-        // Iterate through the map's contents
-        for (auto map_iterator: stored_facts_) {
-            // Pass the current Fact to the function
-            iterating_function(map_iterator.first, map_iterator.second);
+            // Catch if the session value was not assigned
+            if (!assigned) {
+                rejected_facts.insert(current_entry.key());
+            }
         }
+
+        // Return the Facts that could not be assigned
+        return rejected_facts;
     }
 
     void to_json(nlohmann::json& json_sys, const FactDatabase& target) {
-        // Just export the map's contents
-        json_sys = target.stored_facts_;
+        // Export the Facts by name
+        json_sys = nlohmann::json::object();
+        for (const auto& map_iterator: target.storage_->fact_handles_) {
+            json_sys[map_iterator.first] = target.storage_->stored_facts_[map_iterator.second].value();
+        }
     }
 
     void from_json(const nlohmann::json& json_sys, FactDatabase& target) {
-        // Just import the map's contents;
-        target.stored_facts_ = json_sys.get<std::unordered_map<std::string, VariantFact>>();
+        // Discard the existing Facts without touching any forks, and take a new identity as the handles will be issued again
+        target.storage_ = std::make_shared<FactDatabase::Storage>();
+        target.storage_->identity_ = NextIdentity();
+        target.session_values_ = SessionStore();
+
+        // Import the Facts, interning their names
+        for (auto& map_iterator: json_sys.get<std::unordered_map<std::string, VariantFact>>()) {
+            target.storage_->fact_handles_.emplace(map_iterator.first, (FactHandle) target.storage_->stored_facts_.size());
+            target.storage_->handle_names_.push_back(map_iterator.first);
+            target.storage_->stored_facts_.emplace_back(std::move(map_iterator.second));
+        }
+        target.session_values_.Resize(target.storage_->stored_facts_.size());
+        target.storage_->stored_handles_.Resize(target.storage_->stored_facts_.size());
+        for (std::size_t handle = 0; handle < target.storage_->stored_facts_.size(); handle++) {
+            target.storage_->stored_handles_.Set(handle);
+        }
     }
 
 } // namespace expert_system::knowledge::facts
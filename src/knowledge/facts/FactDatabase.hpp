@@ -1,15 +1,26 @@
 #pragma once
 
+#include <cstdint>
+#include <deque>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <variant>
+#include <vector>
 
 #include "nlohmann/json.hpp"
 
+#include "knowledge/facts/FactHandle.hpp"
 #include "knowledge/facts/Facts.hpp"
+#include "knowledge/facts/SessionStore.hpp"
+#include "knowledge/facts/Values.hpp"
+#include "utility/Bitset.hpp"
+#include "utility/Counters.hpp"
 #include "utility/Types.hpp"
 
 namespace expert_system::knowledge::facts {
@@ -27,11 +38,68 @@ namespace expert_system::knowledge::facts {
          */
     using FactIteratingFunction = std::function<void(const std::string& name, VariantFact& fact)>;
 
-        /// A database to centralize the storage and operation of Facts.
+        /**
+         * @brief Type definition for the functions that can be used to iterate through the FactDatabase's handles.
+         * Compatible functions must take a FactHandle, and return void.
+         */
+    using HandleIteratingFunction = std::function<void(FactHandle handle)>;
+
+        /**
+         * @brief A database to centralize the storage and operation of Facts.
+         * Each stored Fact's name is interned to a FactHandle, which is never reused for another Fact.
+         * The Facts' descriptions and Ranges are stored with each Fact, while their session values are stored
+         * separately in a columnar SessionStore, so that session data can be scanned without visiting each Fact.
+         * Forks of a FactDatabase share its Facts and session value pages, copying them only when they are changed.
+         */
     class FactDatabase {
     public:
             /// Default constructor.
-        FactDatabase() = default;
+        FactDatabase();
+
+            /**
+             * @brief Copy constructor.
+             * @param [in] target The FactDatabase to copy.
+             * @note The copy has its own identity, so FactBindings to the original must be bound again.
+             */
+        FactDatabase(const FactDatabase& target);
+
+            /**
+             * @brief Copy assignment operator.
+             * @param [in] target The FactDatabase to copy.
+             * @return A reference to this FactDatabase.
+             * @note The copy has its own identity, so FactBindings to the original must be bound again.
+             */
+        FactDatabase& operator=(const FactDatabase& target);
+
+            /**
+             * @brief Move constructor.
+             * @param [in] target The FactDatabase to move, which is left empty with a new identity.
+             */
+        FactDatabase(FactDatabase&& target);
+
+            /**
+             * @brief Move assignment operator.
+             * @param [in] target The FactDatabase to move, which is left empty with a new identity.
+             * @return A reference to this FactDatabase.
+             */
+        FactDatabase& operator=(FactDatabase&& target);
+
+            /**
+             * @brief Creates a copy-on-write branch of the FactDatabase, for what-if consultations.
+             * The branch shares the Facts and the session value pages with this FactDatabase, and keeps its identity,
+             * so existing FactBindings stay valid in both.
+             * Assigning a session value only copies the 64 handle page that it lands in, while changing the Facts
+             * themselves (creating, finding by mutable reference, or deleting) copies all of them first.
+             * @return The branch, which is independent from this FactDatabase.
+             * @warning References gathered through the non-const Find() before forking may refer to the shared Facts!
+             */
+        [[nodiscard]] FactDatabase Fork() const;
+
+            /**
+             * @brief Checks if the Facts are still shared with a fork.
+             * @return True if another FactDatabase shares the Facts, False otherwise.
+             */
+        [[nodiscard]] bool Shared() const;
 
             /**
              * @brief Attempts to create and store a new Fact into the database.
@@ -49,6 +117,45 @@ namespace expert_system::knowledge::facts {
              */
         std::optional<std::reference_wrapper<VariantFact>> Find(const std::string& name);
 
+            /**
+             * @brief Attempts to gather a stored Fact by handle.
+             * @param [in] handle The FactHandle of the target Fact.
+             * @return A reference to the Fact if successful, or std::nullopt otherwise.
+             */
+        std::optional<std::reference_wrapper<VariantFact>> Find(FactHandle handle);
+
+            /**
+             * @brief Attempts to gather a stored Fact by handle, without allowing it to be changed.
+             * @param [in] handle The FactHandle of the target Fact.
+             * @return A const reference to the Fact if successful, or std::nullopt otherwise.
+             * @note Being read-only, this never copies Facts that are shared with a fork.
+             */
+        [[nodiscard]] std::optional<std::reference_wrapper<const VariantFact>> Find(FactHandle handle) const;
+
+            /**
+             * @brief Attempts to gather a stored Fact through a cached FactBinding, falling back to its name.
+             * @param [in] name The name of the target Fact.
+             * @param [in,out] binding The cached binding for the name, updated if it was not issued by this database.
+             * @return A const reference to the Fact if successful, or std::nullopt otherwise.
+             * @note Only hashes the name the first time the binding is used with this database.
+             * @note Being read-only, this never copies Facts that are shared with a fork.
+             */
+        std::optional<std::reference_wrapper<const VariantFact>> Find(const std::string& name, FactBinding& binding) const;
+
+            /**
+             * @brief Gathers the FactHandle interned for a Fact's name.
+             * @param [in] name The name of the target Fact.
+             * @return The FactHandle if the Fact exists, or std::nullopt otherwise.
+             */
+        [[nodiscard]] std::optional<FactHandle> Handle(const std::string& name) const;
+
+            /**
+             * @brief Creates a FactBinding for a Fact's name, for repeated lookups through Find().
+             * @param [in] name The name of the target Fact.
+             * @return The FactBinding, which is unbound if the Fact does not exist.
+             */
+        [[nodiscard]] FactBinding Bind(const std::string& name) const;
+
             /**
              * @brief Checks if a specified Fact has a 'known' (session) value.
              * @param [in] name The name of the target Fact.
@@ -56,6 +163,176 @@ namespace expert_system::knowledge::facts {
              */
         bool Known(const std::string& name);
 
+            /**
+             * @brief Checks if a specified Fact has a 'known' (session) value.
+             * @param [in] handle The FactHandle of the target Fact.
+             * @return True if the Fact could be found with a session value, False otherwise.
+             */
+        [[nodiscard]] bool Known(FactHandle handle) const;
+
+            /**
+             * @brief Checks if a session value could be assigned to a Fact, ignoring any existing session value.
+             * @tparam T The raw type of the Fact, enum Facts use int with DynamicEnum index values.
+             * @param [in] handle The FactHandle of the target Fact.
+             * @param [in] value The session value for the Fact.
+             * @return std::nullopt if the Fact exists, its type matches T, and the value is within its Range,
+             * or the Counter for the reason the value would be rejected otherwise.
+             */
+        template<class T>
+        [[nodiscard]] std::optional<utility::Counter> CheckValue(FactHandle handle, T value) const {
+            // Catch an invalid handle, or a deleted Fact
+            const auto& stored_facts = storage_->stored_facts_;
+            if ((handle >= stored_facts.size()) || !stored_facts[handle].has_value()) {
+                // Stop and indicate failure
+                return utility::Counter::kRejectedMissingFact;
+            }
+
+            // Catch if the Fact's type does not match
+            auto raw_fact = RawFact<T>(stored_facts[handle].value());
+            if (raw_fact == nullptr) {
+                // Stop and indicate failure
+                return utility::Counter::kRejectedTypeMismatch;
+            }
+
+            // Check if the Fact has an assigned range
+            auto fact_range = raw_fact->GetRange();
+            if (fact_range.has_value()) {
+                // Check if the provided value is not valid
+                if (!utility::Range<T>::InRange(fact_range.value(), value)) {
+                    // Catch an invalid value and stop
+                    return utility::Counter::kRejectedOutOfRange;
+                }
+            }
+
+            // The value can be assigned
+            return std::nullopt;
+        }
+
+            /**
+             * @brief Assigns a session value to a Fact through a filter.
+             * This prevents values outside of the Fact's Range from being assigned.
+             * If a value is already assigned, new values will be discarded if they have a lower confidence factor.
+             * @tparam T The raw type of the Fact, enum Facts use int with DynamicEnum index values.
+             * @param [in] handle The FactHandle of the target Fact.
+             * @param [in] value The session value for the Fact.
+             * @param [in] confidence_factor A specifier of the session value's confidence factor.
+             * @return True if the provided value is assigned, False otherwise.
+             * @note This will fail if the Fact does not exist, or if its type does not match T.
+             */
+        template<class T>
+        bool SetValue(FactHandle handle, T value, const utility::Confidence& confidence_factor) {
+            // Catch a missing Fact, a mismatching type, or a value outside of the Fact's Range
+            auto rejection = CheckValue<T>(handle, value);
+            if (rejection.has_value()) {
+                // Count the reason and indicate failure
+                utility::Count(rejection.value());
+                return false;
+            }
+
+            // Stop the assignment if the Fact already has a value with a higher confidence factor
+            if (session_values_.Known(handle)
+                && (confidence_factor.Get() < session_values_.Confidence(handle))) {
+                // Catch the less confident value and stop
+                utility::Count(utility::Counter::kRejectedLowerConfidence);
+                return false;
+            }
+
+            // Assign the new value and indicate success
+            utility::Confidence stored_confidence(confidence_factor);
+            session_values_.Store<T>(handle, Value<T>(value, stored_confidence));
+            utility::Count(utility::Counter::kAssignmentsApplied);
+            return true;
+        }
+
+            /**
+             * @brief Assigns a Range to a Fact, which will be used to check if a provided session value is valid.
+             * @tparam T The raw type of the Fact, enum Facts use int with DynamicEnum index values.
+             * @param [in] handle The FactHandle of the target Fact.
+             * @param [in] min The Range's minimum value.
+             * @param [in] max The Range's maximum value.
+             * @param [in] bounds_inclusive Flag for including the bounds of the Range.
+             * @return True if the Range is valid and no session value is assigned, False otherwise.
+             * @note The Fact's Range will not be modified if this returns False.
+             */
+        template<class T>
+        bool SetRange(FactHandle handle, T min, T max, bool bounds_inclusive) {
+            // Catch a session value existing
+            if (session_values_.Known(handle)) {
+                // Catch possible invalidation of session value and stop
+                return false;
+            }
+
+            // Catch a missing Fact
+            auto found_fact = Find(handle);
+            if (!found_fact.has_value()) {
+                // Stop and indicate failure
+                return false;
+            }
+
+            // Catch if the Fact's type does not match
+            auto raw_fact = RawFact<T>(found_fact.value().get());
+            if (raw_fact == nullptr) {
+                // Stop and indicate failure
+                return false;
+            }
+
+            // Attempt to assign the Range
+            return raw_fact->SetRange(min, max, bounds_inclusive);
+        }
+
+            /**
+             * @brief Gather a copy of a Fact's session value.
+             * @tparam T The raw type of the Fact, enum Facts use int with DynamicEnum index values.
+             * @param [in] handle The FactHandle of the target Fact.
+             * @return A copy of the session value, or std::nullopt if the Fact has no session value.
+             * @warning T must match the Fact's type, which should be confirmed before use!
+             */
+        template<class T>
+        [[nodiscard]] std::optional<Value<T>> GetValue(FactHandle handle) const {
+            // Rebuild the session value from the store
+            return session_values_.Load<T>(handle);
+        }
+
+            /**
+             * @brief Gather a copy of a Fact's session value, along with its type.
+             * @param [in] name The name of the target Fact.
+             * @return The VariantValue, which has the kUnknown type if the Fact could not be found with a session value.
+             */
+        [[nodiscard]] VariantValue GetVariantValue(const std::string& name) const;
+
+            /**
+             * @brief Removes a Fact's session value.
+             * @param [in] handle The FactHandle of the target Fact.
+             * @note This will have no effect if the Fact does not have a session value assigned.
+             */
+        void ClearValue(FactHandle handle);
+
+            /**
+             * @brief Adds an enum value to an enum Fact, keeping its session value and Range on the same enum values.
+             * @param [in] fact_name The name of the target enum Fact.
+             * @param [in] enum_name The name of the new enum value.
+             * @param [in] position The intended position of the new enum value, see DynamicEnum::Insert().
+             * @return True if the enum value was added, False otherwise.
+             * @note The session value and Range are stored by position, so they are moved along with their enum values.
+             */
+        bool InsertEnumValue(const std::string& fact_name, const std::string& enum_name, int position);
+
+            /**
+             * @brief Removes an enum value from an enum Fact, keeping its session value and Range on the same enum values.
+             * @param [in] fact_name The name of the target enum Fact.
+             * @param [in] enum_name The name of the enum value to remove.
+             * @return True if the enum value existed and was removed, False otherwise.
+             * @note The session value is cleared if it was the removed enum value, as is the Range if it started or
+             * ended with it.
+             */
+        bool RemoveEnumValue(const std::string& fact_name, const std::string& enum_name);
+
+            /**
+             * @brief Provides read access to the columnar session values, indexed by FactHandle.
+             * @return A const reference to the SessionStore.
+             */
+        [[nodiscard]] const SessionStore& SessionValues() const;
+
             /**
              * @brief Gathers a list of the stored Fact names.
              * @param [in] filter The identifier of the filter to apply.
@@ -70,6 +347,34 @@ namespace expert_system::knowledge::facts {
              */
         int Count();
 
+            /**
+             * @brief Gathers the amount of the stored Facts with a session value.
+             * @return The amount of known Facts.
+             * @note The amount is kept up to date by every change, so this does not visit the Facts.
+             */
+        [[nodiscard]] std::size_t CountKnown() const;
+
+            /**
+             * @brief Gathers the amount of the stored Facts without a session value.
+             * @return The amount of unknown Facts.
+             * @note The amount is kept up to date by every change, so this does not visit the Facts.
+             */
+        [[nodiscard]] std::size_t CountUnknown() const;
+
+            /**
+             * @brief Checks if any of the stored Facts do not have a session value.
+             * @return True if at least one Fact is unknown, False otherwise.
+             * @note Equivalent to checking List(FactFilter::kHasNoValue) for emptiness, without building the list.
+             */
+        [[nodiscard]] bool AnyUnknown() const;
+
+            /**
+             * @brief Gathers the name of a stored Fact.
+             * @param [in] handle The FactHandle of the target Fact.
+             * @return A reference to the Fact's name if successful, or std::nullopt otherwise.
+             */
+        [[nodiscard]] std::optional<std::reference_wrapper<const std::string>> Name(FactHandle handle) const;
+
             /**
              * @brief Attempts to delete a specific stored Fact.
              * @param [in] name The name of the target Fact.
@@ -97,12 +402,98 @@ namespace expert_system::knowledge::facts {
              */
         void Iterate(const FactIteratingFunction& iterating_function);
 
+            /**
+             * @brief Iterates over the handles of the stored Facts that pass a filter, in ascending order.
+             * @param [in] filter The identifier of the filter to apply.
+             * @param [in] iterating_function A reference to function that can process the FactHandles.
+             * @note Only the matching handles are visited, by scanning the known and stored bits a word at a time.
+             */
+        void IterateHandles(FactFilter filter, const HandleIteratingFunction& iterating_function) const;
+
+            /**
+             * @brief Assigns session values to the stored Facts from JSON format.
+             * Expects an object mapping each Fact's name to an object with a "value" and a "confidence".
+             * @param [in] json_values A reference to a JSON object.
+             * @return A set of the Fact names that could not be assigned a session value.
+             * @note Enum session values are provided using the name of their enum value.
+             * @note Session values are assigned through each Fact's filter, see SetValue().
+             */
+        std::set<std::string> ImportValues(const nlohmann::json& json_values);
+
     private:
             /**
-             * @brief The database for all stored Facts.
-             * Maps the Fact name to its data structure.
+             * @brief Gathers the raw Fact that holds the Range for a session value type.
+             * @tparam T The raw type of the session value.
+             * @param [in] fact The stored Fact.
+             * @return A pointer to the raw Fact, or nullptr if the Fact's type does not match T.
              */
-        std::unordered_map<std::string, VariantFact> stored_facts_;
+        template<class T>
+        static const Fact<T>* RawFact(const VariantFact& fact) {
+            // Enum Facts store their session values as integers
+            if constexpr (std::is_same_v<T, int>) {
+                auto enum_fact = std::get_if<EnumFact>(&fact.fact_);
+                if (enum_fact != nullptr) {
+                    return &enum_fact->fact_;
+                }
+            }
+
+            // Gather the matching raw Fact, if there is one
+            return std::get_if<Fact<T>>(&fact.fact_);
+        }
+
+            /**
+             * @brief Gathers the raw Fact that holds the Range for a session value type, allowing it to be changed.
+             * @tparam T The raw type of the session value.
+             * @param [in] fact The stored Fact.
+             * @return A pointer to the raw Fact, or nullptr if the Fact's type does not match T.
+             */
+        template<class T>
+        static Fact<T>* RawFact(VariantFact& fact) {
+            // Reuse the read-only lookup, the Fact itself was never const
+            return const_cast<Fact<T>*>(RawFact<T>(std::as_const(fact)));
+        }
+
+            /// The Facts and their names, which forks of a FactDatabase share until either changes them.
+        struct Storage {
+                /**
+                 * @brief The database for all stored Facts, indexed by FactHandle.
+                 * Deleted Facts leave an empty slot, so that their handle is never reused.
+                 * @note A deque is used so that references to the stored Facts survive the creation of new Facts.
+                 */
+            std::deque<std::optional<VariantFact>> stored_facts_;
+
+                /// The FactHandles of the stored Facts, deleted Facts' handles are unset.
+            utility::Bitset stored_handles_;
+
+                /// The name of each stored Fact, indexed by FactHandle.
+            std::vector<std::string> handle_names_;
+
+                /// Maps each stored Fact's name to its FactHandle.
+            std::unordered_map<std::string, FactHandle> fact_handles_;
+
+                /// A process-unique identity, used to check that a FactBinding was issued for these Facts.
+            std::uint64_t identity_ = 0;
+        };
+
+            /**
+             * @brief Edits the enum values of an enum Fact, moving its session value and Range to their new positions.
+             * @param [in] fact_name The name of the target enum Fact.
+             * @param [in] edit The edit to perform on the Fact's DynamicEnum, returning True if it changed.
+             * @return True if the Fact was found and edited, False otherwise.
+             */
+        bool EditEnum(const std::string& fact_name, const std::function<bool(utility::DynamicEnum&)>& edit);
+
+            /**
+             * @brief Gives this FactDatabase its own copy of the Facts, if they are shared with a fork.
+             * @note The copy takes a new identity, as its FactHandles may diverge from the fork's.
+             */
+        void Detach();
+
+            /// The stored Facts, which may be shared with forks of this FactDatabase.
+        std::shared_ptr<Storage> storage_;
+
+            /// The session values of the stored Facts, indexed by FactHandle.
+        SessionStore session_values_;
 
             /// Enables JSON serializer access to private contents
         friend void to_json(nlohmann::json& json_sys, const FactDatabase& target);
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace expert_system::knowledge::facts {
+
+        /**
+         * @brief A dense integer identifier for a Fact, interned from its name by a FactDatabase.
+         * @warning A handle is only meaningful to the FactDatabase that issued it!
+         */
+    using FactHandle = std::uint32_t;
+
+        /// The FactHandle that never identifies a Fact.
+    constexpr FactHandle kInvalidFactHandle = std::numeric_limits<FactHandle>::max();
+
+        /**
+         * @brief A cached FactHandle, remembering which FactDatabase issued it.
+         * Allows repeated lookups of the same Fact to skip hashing its name.
+         */
+    struct FactBinding {
+            /// The cached FactHandle.
+        FactHandle handle_ = kInvalidFactHandle;
+
+            /// The identity of the FactDatabase that issued the handle, or 0 if unbound.
+        std::uint64_t database_ = 0;
+    };
+
+} // namespace expert_system::knowledge::facts
@@ -0,0 +1,69 @@
+#include "SessionStore.hpp"
+
+#include <atomic>
+
+namespace expert_system::knowledge::facts {
+
+    void SessionStore::Resize(std::size_t size) {
+        // Resize the known bits, new FactHandles start unknown
+        known_.Resize(size);
+
+        // Add or drop whole pages, new pages are owned only by this store
+        auto page_count = (size + kPageSize - 1) / kPageSize;
+        while (pages_.size() < page_count) {
+            pages_.push_back(std::make_shared<Page>());
+        }
+        pages_.resize(page_count);
+    }
+
+    std::size_t SessionStore::Size() const {
+        // Provide the amount of FactHandles
+        return known_.Size();
+    }
+
+    void SessionStore::Clear(FactHandle handle) {
+        // Clear the FactHandle's bit, the stale column data is never read
+        known_.Reset(handle);
+    }
+
+    void SessionStore::ClearAll() {
+        // Clear every bit, the stale column data is never read
+        known_.ResetAll();
+    }
+
+    std::size_t SessionStore::CountKnown() const {
+        // Provide the running count of known FactHandles
+        return known_.Count();
+    }
+
+    const utility::Bitset& SessionStore::KnownHandles() const {
+        // Provide read access to the known bits
+        return known_;
+    }
+
+    std::size_t SessionStore::UnsharedPages() const {
+        // Count the pages that no other store refers to
+        std::size_t unshared_pages = 0;
+        for (const auto& current_page: pages_) {
+            if (current_page.use_count() == 1) {
+                unshared_pages++;
+            }
+        }
+        return unshared_pages;
+    }
+
+    SessionStore::Page& SessionStore::WritablePage(std::size_t page_index) {
+        // Copy the page if another store still refers to it
+        auto& target_page = pages_[page_index];
+        if (target_page.use_count() != 1) {
+            target_page = std::make_shared<Page>(*target_page);
+        } else {
+            // Make sure the other stores' final reads of the page happen before it is written to
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+
+        // Provide the page, which is now owned only by this store
+        return *target_page;
+    }
+
+} // namespace expert_system::knowledge::facts
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "knowledge/facts/FactHandle.hpp"
+#include "knowledge/facts/Value.hpp"
+#include "utility/Bitset.hpp"
+#include "utility/Confidence.hpp"
+
+namespace expert_system::knowledge::facts {
+
+        /**
+         * @brief Columnar storage for the session values of a FactDatabase's Facts, indexed by FactHandle.
+         * Each part of a session value is kept in its own contiguous array, with a bitset marking the known Facts.
+         * The columns are split into fixed-size pages, which copies of the store share until either copy writes to them.
+         * @note Enum session values are stored in the integer column, using DynamicEnum index values.
+         */
+    class SessionStore {
+    public:
+            /// Default constructor, creates an empty store.
+        SessionStore() = default;
+
+            /**
+             * @brief Changes the amount of FactHandles that the store has room for.
+             * @param [in] size The new amount of FactHandles.
+             * @note New FactHandles start without a session value.
+             */
+        void Resize(std::size_t size);
+
+            /**
+             * @brief Gathers the amount of FactHandles that the store has room for.
+             * @return The amount of FactHandles.
+             */
+        [[nodiscard]] std::size_t Size() const;
+
+            /**
+             * @brief Checks if a FactHandle has a session value.
+             * @param [in] handle The FactHandle to check.
+             * @return True if the FactHandle is in the store and has a session value, False otherwise.
+             */
+        [[nodiscard]] bool Known(FactHandle handle) const {
+            // Check the FactHandle's bit
+            return known_.Test(handle);
+        };
+
+            /**
+             * @brief Gathers the confidence factor of a FactHandle's session value.
+             * @param [in] handle The target FactHandle.
+             * @return The raw confidence factor, only valid if the FactHandle is known.
+             */
+        [[nodiscard]] float Confidence(FactHandle handle) const {
+            // Provide the raw confidence factor
+            return pages_[handle / kPageSize]->confidences_[handle % kPageSize];
+        };
+
+            /**
+             * @brief Stores a session value for a FactHandle, replacing any existing session value.
+             * @tparam T The raw type of the session value, only bool, int and float are supported.
+             * @param [in] handle The target FactHandle, which must be in the store.
+             * @param [in] value The session value to store.
+             * @note If the FactHandle's page is shared with another store, the page is copied first.
+             */
+        template<class T>
+        void Store(FactHandle handle, const Value<T>& value) {
+            // Store the raw value in its type's column
+            auto& page = WritablePage(handle / kPageSize);
+            auto slot = handle % kPageSize;
+            Column<T>(page)[slot] = value.value_;
+
+            // Store the metadata, and mark the FactHandle as known
+            page.confidences_[slot] = value.confidence_factor_.Get();
+            page.timestamps_[slot] = value.timestamp_;
+            known_.Set(handle);
+        }
+
+            /**
+             * @brief Gathers a copy of a FactHandle's session value.
+             * @tparam T The raw type of the session value, only bool, int and float are supported.
+             * @param [in] handle The target FactHandle.
+             * @return A copy of the session value, or std::nullopt if the FactHandle has no session value.
+             * @warning T must match the type the session value was stored with!
+             */
+        template<class T>
+        [[nodiscard]] std::optional<Value<T>> Load(FactHandle handle) const {
+            // Catch a FactHandle without a session value
+            if (!Known(handle)) {
+                return std::nullopt;
+            }
+
+            // Rebuild the session value from the columns
+            const auto& page = *pages_[handle / kPageSize];
+            auto slot = handle % kPageSize;
+            return Value<T>(static_cast<T>(Column<T>(page)[slot]),
+                            utility::Confidence(page.confidences_[slot]),
+                            page.timestamps_[slot]);
+        }
+
+            /**
+             * @brief Removes a FactHandle's session value.
+             * @param [in] handle The target FactHandle.
+             * @note This will have no effect if the FactHandle has no session value.
+             */
+        void Clear(FactHandle handle);
+
+            /// Removes every session value, without changing the store's size.
+        void ClearAll();
+
+            /**
+             * @brief Gathers the amount of FactHandles with a session value.
+             * @return The amount of known FactHandles.
+             * @note The amount is kept up to date by every change, so this does not scan the store.
+             */
+        [[nodiscard]] std::size_t CountKnown() const;
+
+            /**
+             * @brief Provides read access to the set of FactHandles with a session value.
+             * @return A const reference to the known Bitset.
+             */
+        [[nodiscard]] const utility::Bitset& KnownHandles() const;
+
+            /**
+             * @brief Gathers the amount of pages that are not shared with another store.
+             * @return The amount of unshared pages.
+             * @note A copied store starts with no unshared pages, and gains one for each page it writes to.
+             */
+        [[nodiscard]] std::size_t UnsharedPages() const;
+
+    private:
+            /// The amount of FactHandles in each page.
+        static constexpr std::size_t kPageSize = 64;
+
+            /// A fixed-size slice of every column.
+        struct Page {
+                /// The boolean session values, stored as bytes.
+            std::array<std::uint8_t, kPageSize> bool_values_{};
+
+                /// The integer and enum session values.
+            std::array<int, kPageSize> int_values_{};
+
+                /// The float session values.
+            std::array<float, kPageSize> float_values_{};
+
+                /// The raw confidence factors of the session values.
+            std::array<float, kPageSize> confidences_{};
+
+                /// The times that the session values were constructed.
+            std::array<std::chrono::time_point<std::chrono::system_clock>, kPageSize> timestamps_{};
+        };
+
+            /**
+             * @brief Gathers a page for writing, copying it first if it is shared with another store.
+             * @param [in] page_index The index of the page.
+             * @return A reference to the page, owned only by this store.
+             */
+        Page& WritablePage(std::size_t page_index);
+
+            /**
+             * @brief Gathers the column for a raw type from a page.
+             * @tparam T The raw type of the column.
+             * @tparam PageType Page or const Page.
+             * @param [in] page The page to gather the column from.
+             * @return A reference to the column.
+             */
+        template<class T, class PageType>
+        static auto& Column(PageType& page) {
+            if constexpr (std::is_same_v<T, bool>) {
+                return page.bool_values_;
+            } else if constexpr (std::is_same_v<T, int>) {
+                return page.int_values_;
+            } else {
+                static_assert(std::is_same_v<T, float>, "Unsupported session value type");
+                return page.float_values_;
+            }
+        }
+
+            /// The FactHandles with a session value.
+        utility::Bitset known_;
+
+            /// The pages of the columns, which may be shared with copies of the store.
+        std::vector<std::shared_ptr<Page>> pages_;
+    };
+
+} // namespace expert_system::knowledge::facts
@@ -28,6 +28,16 @@ namespace expert_system::knowledge::facts {
             timestamp_ = std::chrono::system_clock::now();
         };
 
+            /**
+             * @brief Parameterized constructor, restores a session value with existing metadata.
+             * @param [in] value The session value for the Fact.
+             * @param [in] confidence_factor A specifier of the session value's confidence factor.
+             * @param [in] timestamp The time that the session value was originally constructed.
+             */
+        Value(T value, const utility::Confidence& confidence_factor,
+              std::chrono::time_point<std::chrono::system_clock> timestamp)
+            : value_(value), confidence_factor_(confidence_factor), timestamp_(timestamp) {};
+
             /// The session value of a Fact.
         T value_;
 
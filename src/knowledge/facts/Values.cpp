@@ -1,5 +1,7 @@
 #include "Values.hpp"
 
+#include "utility/SymbolsJSON.hpp"
+
 namespace expert_system::knowledge::facts {
 
     EnumValue::EnumValue(const utility::DynamicEnum& value_enum, IntValue value_data)
@@ -9,72 +11,50 @@ namespace expert_system::knowledge::facts {
         : type_(utility::ExpertSystemTypes::kUnknown),
           value_(std::monostate()) {};
 
-    VariantValue::VariantValue(VariantFact value) {
-        // Store the type
-        type_ = value.type_;
+    void to_json(nlohmann::json& json_sys, const VariantValue& target) {
+        // Assign the type
+        json_sys[utility::JSON_ID_TYPE] = target.type_;
 
-        // Split the logic based on the type
-        switch (type_) {
+        // Split logic depending on the current type
+        switch (target.type_) {
             case utility::ExpertSystemTypes::kBool: {
-                // Catch if the provided Fact actually has a session value
-                auto raw_value = std::get<BoolFact>(value.fact_).GetValue();
-                if (!raw_value.has_value()) {
-                    // Don't store any data
-                    type_ = utility::ExpertSystemTypes::kUnknown;
-                    value_ = std::monostate();
-                    break;
-                }
-
-                // Copy the stored Value
-                value_ = raw_value.value();
+                // Export the raw Value and its confidence factor
+                auto& raw_value = std::get<BoolValue>(target.value_);
+                json_sys[utility::JSON_ID_VALUE] = raw_value.value_;
+                json_sys[utility::JSON_ID_CONFIDENCE] = raw_value.confidence_factor_;
                 break;
             }
             case utility::ExpertSystemTypes::kInt: {
-                // Catch if the provided Fact actually has a session value
-                auto raw_value = std::get<IntFact>(value.fact_).GetValue();
-                if (!raw_value.has_value()) {
-                    // Don't store any data
-                    type_ = utility::ExpertSystemTypes::kUnknown;
-                    value_ = std::monostate();
-                    break;
-                }
-
-                // Copy the stored Value
-                value_ = raw_value.value();
+                // Export the raw Value and its confidence factor
+                auto& raw_value = std::get<IntValue>(target.value_);
+                json_sys[utility::JSON_ID_VALUE] = raw_value.value_;
+                json_sys[utility::JSON_ID_CONFIDENCE] = raw_value.confidence_factor_;
                 break;
             }
             case utility::ExpertSystemTypes::kFloat: {
-                // Catch if the provided Fact actually has a session value
-                auto raw_value = std::get<FloatFact>(value.fact_).GetValue();
-                if (!raw_value.has_value()) {
-                    // Don't store any data
-                    type_ = utility::ExpertSystemTypes::kUnknown;
-                    value_ = std::monostate();
-                    break;
-                }
-
-                // Copy the stored Value
-                value_ = raw_value.value();
+                // Export the raw Value and its confidence factor
+                auto& raw_value = std::get<FloatValue>(target.value_);
+                json_sys[utility::JSON_ID_VALUE] = raw_value.value_;
+                json_sys[utility::JSON_ID_CONFIDENCE] = raw_value.confidence_factor_;
                 break;
             }
             case utility::ExpertSystemTypes::kEnum: {
-                // Catch if the provided Fact actually has a session value
-                auto raw_fact = std::get<EnumFact>(value.fact_);
-                if (!raw_fact.fact_.GetValue().has_value()) {
-                    // Don't store any data
-                    type_ = utility::ExpertSystemTypes::kUnknown;
-                    value_ = std::monostate();
-                    break;
+                // Convert the raw Value to its enum value's name
+                auto raw_value = std::get<EnumValue>(target.value_);
+                auto value_name = raw_value.enum_.At(raw_value.value_.value_);
+                if (value_name.has_value()) {
+                    json_sys[utility::JSON_ID_VALUE] = value_name.value();
+                } else {
+                    json_sys[utility::JSON_ID_VALUE] = nullptr;
                 }
 
-                // Copy the stored Value
-                value_ = EnumValue(raw_fact.enum_, raw_fact.fact_.GetValue().value());
+                // Export the confidence factor
+                json_sys[utility::JSON_ID_CONFIDENCE] = raw_value.value_.confidence_factor_;
                 break;
             }
             default: {
-                // Don't store any data
-                type_ = utility::ExpertSystemTypes::kUnknown;
-                value_ = std::monostate();
+                // Store a null Value
+                json_sys[utility::JSON_ID_VALUE] = nullptr;
                 break;
             }
         }
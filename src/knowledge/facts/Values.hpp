@@ -2,6 +2,8 @@
 
 #include <variant>
 
+#include "nlohmann/json.hpp"
+
 #include "knowledge/facts/Facts.hpp"
 #include "knowledge/facts/Value.hpp"
 #include "utility/DynamicEnum.hpp"
@@ -38,7 +40,10 @@ namespace expert_system::knowledge::facts {
         /// Type-safe union of the four Value types
     using GenericValue = std::variant<std::monostate, BoolValue, IntValue, FloatValue, EnumValue>;
 
-        /// Type-tracked Generic Fact
+        /**
+         * @brief Type-tracked Generic Value.
+         * @note Gathered from a stored Fact through FactDatabase::GetVariantValue().
+         */
     struct VariantValue {
             /**
              * @brief Default constructor.
@@ -46,13 +51,6 @@ namespace expert_system::knowledge::facts {
              */
         VariantValue();
 
-            /**
-             * Parameterized constructor.
-             * Copies the Value from an existing Fact and automatically determines its type.
-             * @param [in] value The Fact to gather a Value from.
-             */
-        explicit VariantValue(VariantFact value);
-
             /**
              * @brief A hint for the type of Value that is stored.
              * @warning This may be incorrect, and should be confirmed before use of the Value!
@@ -63,4 +61,12 @@ namespace expert_system::knowledge::facts {
         GenericValue value_;
     };
 
+        /**
+         * @brief VariantValue serialization to JSON format.
+         * @param [in,out] json_sys A reference to a JSON object.
+         * @param [in] target A reference to the VariantValue to export.
+         * @note Enum Values are exported using the name of their enum value.
+         */
+    void to_json(nlohmann::json& json_sys, const VariantValue& target);
+
 } // namespace expert_system::knowledge::facts
@@ -4,7 +4,66 @@
 
 namespace expert_system::knowledge::rules {
 
-    TestOutcome Antecedent::Test(facts::FactDatabase& source) {
+    TestOutcome Chain(ConnectorType connector, TestOutcome combined, TestOutcome local) {
+        // Chain the outcome with the specified ConnectorType
+        switch (connector) {
+            case ConnectorType::kAnd: {
+                // Both outcomes must be successful
+                if ((local == TestOutcome::kComparisonSuccess)
+                    && (combined == TestOutcome::kComparisonSuccess)) {
+                    // Indicate success in the chained result
+                    return TestOutcome::kComparisonSuccess;
+                }
+
+                // Indicate failure in the chained result
+                return TestOutcome::kComparisonFailure;
+            }
+            case ConnectorType::kOr: {
+                // Either outcome must be successful
+                if ((local == TestOutcome::kComparisonSuccess)
+                    || (combined == TestOutcome::kComparisonSuccess)) {
+                    // Indicate success in the chained result
+                    return TestOutcome::kComparisonSuccess;
+                }
+
+                // Indicate failure in the chained result
+                return TestOutcome::kComparisonFailure;
+            }
+            case ConnectorType::kXor: {
+                // The outcomes cannot be identical
+                if (local == combined) {
+                    // Indicate failure in the chained result
+                    return TestOutcome::kComparisonFailure;
+                }
+
+                // Indicate success in the chained result
+                return TestOutcome::kComparisonSuccess;
+            }
+            default: {
+                // Catch an invalid connector
+                return TestOutcome::kUnknown;
+            }
+        }
+    }
+
+    TestOutcome Antecedent::Test(const facts::FactDatabase& source) {
+        // Test every Condition, nothing can be skipped
+        std::size_t skipped_conditions = 0;
+        return Test(source, EvaluationMode::kComplete, skipped_conditions);
+    }
+
+    TestOutcome Antecedent::Test(const facts::FactDatabase& source, EvaluationMode mode, std::size_t& skipped_conditions) {
+        // Nothing has been skipped yet
+        skipped_conditions = 0;
+
+        // Identify the positions to short-circuit from, if requested
+        ShortCircuitPoints short_circuits;
+        short_circuits.failure_from_ = condition_chain_.size() + 1;
+        short_circuits.success_from_ = condition_chain_.size() + 1;
+        if (mode == EvaluationMode::kShortCircuit) {
+            short_circuits = ShortCircuits();
+        }
+
         // Attempt to Test the root Condition and keep track of the outcomes
         auto combined_outcomes = root_condition_.Test(source);
 
@@ -16,7 +75,17 @@ namespace expert_system::knowledge::rules {
         }
 
         // Iterate through the list in order and perform each Test
-        for (auto current_pair: condition_chain_) {
+        std::size_t position = 0;
+        for (auto& current_pair: condition_chain_) {
+            // Catch if the outcome can no longer change
+            if (((combined_outcomes == TestOutcome::kComparisonFailure) && (short_circuits.failure_from_ <= position))
+                || ((combined_outcomes == TestOutcome::kComparisonSuccess) && (short_circuits.success_from_ <= position))) {
+                // Stop and return the final outcome, skipping the remaining Conditions
+                skipped_conditions = condition_chain_.size() - position;
+                return combined_outcomes;
+            }
+            ++position;
+
             // Keep track of the current Condition's outcome
             auto local_outcome = current_pair.second.Test(source);
 
@@ -28,51 +97,48 @@ namespace expert_system::knowledge::rules {
             }
 
             // Chain the outcome with the specified ConnectorType
-            switch (current_pair.first) {
-                case ConnectorType::kAnd: {
-                    // Both outcomes must be successful
-                    if ((local_outcome == TestOutcome::kComparisonSuccess)
-                        && (combined_outcomes == TestOutcome::kComparisonSuccess)) {
-                        // Store success in the chained result
-                        combined_outcomes = TestOutcome::kComparisonSuccess;
-                    }
-                    else {
-                        // Store failure in the chained result
-                        combined_outcomes = TestOutcome::kComparisonFailure;
-                    }
-                    break;
-                }
-                case ConnectorType::kOr: {
-                    // Either outcome must be successful
-                    if ((local_outcome == TestOutcome::kComparisonSuccess)
-                            || (combined_outcomes == TestOutcome::kComparisonSuccess)) {
-                        // Store success in the chained result
-                        combined_outcomes = TestOutcome::kComparisonSuccess;
-                    }
-                    else {
-                        // Store failure in the chained result
-                        combined_outcomes = TestOutcome::kComparisonFailure;
-                    }
-                    break;
-                }
-                case ConnectorType::kXor: {
-                    // The outcomes cannot be identical
-                    if (local_outcome == combined_outcomes) {
-                        // Store failure in the chained result
-                        combined_outcomes = TestOutcome::kComparisonFailure;
-                    } else {
-                        // Store success in the chained result
-                        combined_outcomes = TestOutcome::kComparisonSuccess;
-                    }
-                    break;
-                }
-            }
+            combined_outcomes = Chain(current_pair.first, combined_outcomes, local_outcome);
         }
 
         // Return the final chained outcome
         return combined_outcomes;
     }
 
+    const ShortCircuitPoints& Antecedent::ShortCircuits() {
+        // Analyse the connectors only if they have not been analysed yet
+        if (!short_circuits_.has_value()) {
+            short_circuits_ = AnalyseShortCircuits(*this);
+        }
+
+        // Provide the cached points
+        return short_circuits_.value();
+    }
+
+    void Antecedent::InvalidateShortCircuits() {
+        // Discard the cached points
+        short_circuits_.reset();
+    }
+
+    ShortCircuitPoints AnalyseShortCircuits(const Antecedent& target) {
+        // Iterate through the chained connectors, finding the last that can overturn each outcome
+        ShortCircuitPoints short_circuits;
+        std::size_t position = 0;
+        for (const auto& current_pair: target.condition_chain_) {
+            ++position;
+
+            // Only kAnd keeps a failure, and only kOr keeps a success
+            if (current_pair.first != ConnectorType::kAnd) {
+                short_circuits.failure_from_ = position;
+            }
+            if (current_pair.first != ConnectorType::kOr) {
+                short_circuits.success_from_ = position;
+            }
+        }
+
+        // Return the positions
+        return short_circuits;
+    }
+
     void to_json(nlohmann::json& json_sys, const Antecedent& target) {
         // Export the root Condition
         json_sys[utility::JSON_ID_ROOT] = target.root_condition_;
@@ -85,6 +151,7 @@ namespace expert_system::knowledge::rules {
         // Clear the existing data
         target.root_condition_ = VariantCondition();
         target.condition_chain_.clear();
+        target.InvalidateShortCircuits();
 
         // Confirm the description is actually stored
         if (json_sys.find(utility::JSON_ID_DESCRIPTION) != json_sys.end()) {
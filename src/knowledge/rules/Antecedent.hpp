@@ -1,7 +1,9 @@
 #pragma once
 
-#include <tuple>
+#include <cstddef>
 #include <list>
+#include <optional>
+#include <tuple>
 
 #include "nlohmann/json.hpp"
 
@@ -23,6 +25,40 @@ namespace expert_system::knowledge::rules {
                                  {ConnectorType::kOr, "OR"},
                                  {ConnectorType::kXor, "XOR"}})
 
+        /// The symbolic representations of the Antecedent evaluation modes.
+    enum class EvaluationMode {
+        kComplete,
+        kShortCircuit
+    };
+
+        /**
+         * @brief Chains the outcome of a Condition onto the combined outcome of the preceding Conditions.
+         * @param [in] connector The logical connection between the two outcomes.
+         * @param [in] combined The combined outcome of the preceding Conditions.
+         * @param [in] local The outcome of the Condition being chained.
+         * @return The chained outcome, either kComparisonSuccess or kComparisonFailure.
+         * @warning Both outcomes must already be confirmed as comparison results, not errors!
+         */
+    TestOutcome Chain(ConnectorType connector, TestOutcome combined, TestOutcome local);
+
+        /**
+         * @brief The positions in an Antecedent after which its chained outcome can no longer change.
+         * Position 0 is the root Condition, and position N is the Nth chained Condition.
+         */
+    struct ShortCircuitPoints {
+            /**
+             * @brief Once the Condition at this position has been chained, a failed outcome is final.
+             * Only every following connector being kAnd can keep a failure, as kOr and kXor can overturn it.
+             */
+        std::size_t failure_from_ = 0;
+
+            /**
+             * @brief Once the Condition at this position has been chained, a successful outcome is final.
+             * Only every following connector being kOr can keep a success, as kAnd and kXor can overturn it.
+             */
+        std::size_t success_from_ = 0;
+    };
+
         /**
          * @brief The trigger component of an expert system Rule.
          * Composed of one-to-many Conditions linked with logical connections.
@@ -38,7 +74,31 @@ namespace expert_system::knowledge::rules {
              * @note This will return an error symbol if a Condition could not be operated.
              * @warning No indication will be given for the source of the error!
              */
-        TestOutcome Test(facts::FactDatabase& source);
+        TestOutcome Test(const facts::FactDatabase& source);
+
+            /**
+             * @brief Test the logically linked Conditions, optionally stopping once the outcome can no longer change.
+             * @param [in] source The Fact Database to operate on.
+             * @param [in] mode kComplete to Test every Condition, or kShortCircuit to stop early.
+             * @param [out] skipped_conditions The amount of Conditions that were not tested due to short-circuiting.
+             * @return A TestOutcome enum symbol indicating the test's result.
+             * @note Skipped Conditions can't report errors, so kShortCircuit may succeed or fail where kComplete errors.
+             */
+        TestOutcome Test(const facts::FactDatabase& source, EvaluationMode mode, std::size_t& skipped_conditions);
+
+            /**
+             * @brief Gathers the points that the Antecedent can short-circuit from.
+             * @return The positions after which the failed and successful outcomes are final.
+             * @note The points are cached on the first call, see InvalidateShortCircuits().
+             */
+        const ShortCircuitPoints& ShortCircuits();
+
+            /**
+             * @brief Discards the cached ShortCircuits(), so they are analysed again when next used.
+             * @note This must be called after editing the condition_chain_ in place.
+             * RuleDatabase::Reindex() calls this for the edited Rules.
+             */
+        void InvalidateShortCircuits();
 
             /**
              * @brief The root Condition to begin the test upon.
@@ -51,8 +111,18 @@ namespace expert_system::knowledge::rules {
              * The current result will be chained to next Condition's result.
              */
         std::list<std::pair<ConnectorType, VariantCondition>> condition_chain_;
+
+            /// The cached result of ShortCircuits(), empty until it is first analysed.
+        std::optional<ShortCircuitPoints> short_circuits_;
     };
 
+        /**
+         * @brief Analyses the connectors of an Antecedent for the points it can short-circuit from.
+         * @param [in] target A reference to the Antecedent to analyse.
+         * @return The positions after which the failed and successful outcomes are final.
+         */
+    ShortCircuitPoints AnalyseShortCircuits(const Antecedent& target);
+
         /**
          * @brief Antecedent serialization to JSON format.
          * @param [in,out] json_sys A reference to a JSON object.
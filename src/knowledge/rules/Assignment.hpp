@@ -2,10 +2,13 @@
 
 #include <optional>
 #include <string>
+#include <utility>
 #include <variant>
 
 #include "knowledge/facts/FactDatabase.hpp"
 #include "knowledge/facts/Facts.hpp"
+#include "utility/Counters.hpp"
+#include "utility/DynamicEnum.hpp"
 
 namespace expert_system::knowledge::rules {
 
@@ -21,12 +24,32 @@ namespace expert_system::knowledge::rules {
             /// The identifying name of the target Fact.
         std::string fact_;
 
-            /// The value to assign to the target Fact.
+            /// The cached FactHandle of the target Fact, bound on the first lookup.
+        facts::FactBinding binding_;
+
+            /**
+             * @brief The value to assign to the target Fact.
+             * @warning Use SetValue() to edit the value of an existing Assignment!
+             */
         T value_;
 
+            /// The cached position of an enum value_ in the Fact's DynamicEnum, only used by enum Assignments.
+        utility::EnumBinding value_binding_;
+
             /// The Confidence factor or the value to be assigned.
         utility::Confidence confidence_factor_;
 
+            /**
+             * @brief Replaces the value to assign to the target Fact.
+             * @param [in] value The new value.
+             * @note This discards the cached value_binding_, which only matches the previous value.
+             */
+        void SetValue(T value) {
+            // Store the new value and forget the old value's position
+            value_ = std::move(value);
+            value_binding_ = utility::EnumBinding();
+        }
+
             /**
              * @brief Attempts to perform the Assignment.
              * @param [in] database The Fact Database to operate on.
@@ -40,11 +63,12 @@ namespace expert_system::knowledge::rules {
 
         /// Boolean specialization overload of templated Assignment::Assign.
     template<>
-    bool Assignment<bool>::Assign(facts::FactDatabase& database) {
+    inline bool Assignment<bool>::Assign(facts::FactDatabase& database) {
         // Confirm the identified Fact actually exists
-        auto optional_fact = database.Find(fact_);
+        auto optional_fact = database.Find(fact_, binding_);
         if (!optional_fact.has_value()) {
             // Stop and indicate failure
+            utility::Count(utility::Counter::kRejectedMissingFact);
             return false;
         }
 
@@ -52,21 +76,22 @@ namespace expert_system::knowledge::rules {
         auto& variant_fact = optional_fact.value().get();
         if (variant_fact.type_ != utility::ExpertSystemTypes::kBool) {
             // Catch type mismatch and indicate failure
+            utility::Count(utility::Counter::kRejectedTypeMismatch);
             return false;
         }
 
         // Attempt to assign the Value
-        auto& raw_fact = std::get<facts::BoolFact>(variant_fact.fact_);
-        return raw_fact.SetValue(value_, confidence_factor_);
+        return database.SetValue<bool>(binding_.handle_, value_, confidence_factor_);
     }
 
         /// Integer specialization overload of templated Assignment::Assign.
     template<>
-    bool Assignment<int>::Assign(facts::FactDatabase& database) {
+    inline bool Assignment<int>::Assign(facts::FactDatabase& database) {
         // Confirm the identified Fact actually exists
-        auto optional_fact = database.Find(fact_);
+        auto optional_fact = database.Find(fact_, binding_);
         if (!optional_fact.has_value()) {
             // Stop and indicate failure
+            utility::Count(utility::Counter::kRejectedMissingFact);
             return false;
         }
 
@@ -74,21 +99,22 @@ namespace expert_system::knowledge::rules {
         auto& variant_fact = optional_fact.value().get();
         if (variant_fact.type_ != utility::ExpertSystemTypes::kInt) {
             // Catch type mismatch and indicate failure
+            utility::Count(utility::Counter::kRejectedTypeMismatch);
             return false;
         }
 
         // Attempt to assign the Value
-        auto& raw_fact = std::get<facts::IntFact>(variant_fact.fact_);
-        return raw_fact.SetValue(value_, confidence_factor_);
+        return database.SetValue<int>(binding_.handle_, value_, confidence_factor_);
     }
 
         /// Float specialization overload of templated Assignment::Assign.
     template<>
-    bool Assignment<float>::Assign(facts::FactDatabase& database) {
+    inline bool Assignment<float>::Assign(facts::FactDatabase& database) {
         // Confirm the identified Fact actually exists
-        auto optional_fact = database.Find(fact_);
+        auto optional_fact = database.Find(fact_, binding_);
         if (!optional_fact.has_value()) {
             // Stop and indicate failure
+            utility::Count(utility::Counter::kRejectedMissingFact);
             return false;
         }
 
@@ -96,21 +122,22 @@ namespace expert_system::knowledge::rules {
         auto& variant_fact = optional_fact.value().get();
         if (variant_fact.type_ != utility::ExpertSystemTypes::kFloat) {
             // Catch type mismatch and indicate failure
+            utility::Count(utility::Counter::kRejectedTypeMismatch);
             return false;
         }
 
         // Attempt to assign the Value
-        auto& raw_fact = std::get<facts::FloatFact>(variant_fact.fact_);
-        return raw_fact.SetValue(value_, confidence_factor_);
+        return database.SetValue<float>(binding_.handle_, value_, confidence_factor_);
     }
 
         /// Enumeration specialization overload of templated Assignment::Assign.
     template<>
-    bool Assignment<std::string>::Assign(facts::FactDatabase& database) {
+    inline bool Assignment<std::string>::Assign(facts::FactDatabase& database) {
         // Confirm the identified Fact actually exists
-        auto optional_fact = database.Find(fact_);
+        auto optional_fact = database.Find(fact_, binding_);
         if (!optional_fact.has_value()) {
             // Stop and indicate failure
+            utility::Count(utility::Counter::kRejectedMissingFact);
             return false;
         }
 
@@ -118,17 +145,19 @@ namespace expert_system::knowledge::rules {
         auto& variant_fact = optional_fact.value().get();
         if (variant_fact.type_ != utility::ExpertSystemTypes::kEnum) {
             // Catch type mismatch and indicate failure
+            utility::Count(utility::Counter::kRejectedTypeMismatch);
             return false;
         }
 
         // Attempt to assign the Value
         auto& raw_fact = std::get<facts::EnumFact>(variant_fact.fact_);
-        auto enum_conversion = raw_fact.enum_.At(value_);
+        auto enum_conversion = raw_fact.enum_.At(value_, value_binding_);
         if (enum_conversion == std::nullopt) {
             // Catch the enum value not existing
+            utility::Count(utility::Counter::kRejectedOutOfRange);
             return false;
         }
-        return raw_fact.fact_.SetValue(enum_conversion.value(), confidence_factor_);
+        return database.SetValue<int>(binding_.handle_, enum_conversion.value(), confidence_factor_);
     }
 
 } // namespace expert_system::knowledge::rules
@@ -10,6 +10,7 @@
 #include "knowledge/facts/Facts.hpp"
 #include "knowledge/facts/Value.hpp"
 #include "utility/Confidence.hpp"
+#include "utility/DynamicEnum.hpp"
 
 namespace expert_system::knowledge::rules {
 
@@ -81,20 +82,40 @@ namespace expert_system::knowledge::rules {
              * @param [in] source The Fact Database to operate on.
              * @return A TestOutcome enum symbol indicating the test's result.
              */
-        TestOutcome Test(facts::FactDatabase& source) {
+        TestOutcome Test(const facts::FactDatabase& source) {
             // Not compatible with non-specialized Fact types
             return TestOutcome::kUnknown;
         };
 
+            /**
+             * @brief Replaces the target value for the Condition's test.
+             * @param [in] target The new target value.
+             * @note This discards the cached target_binding_, which only matches the previous target.
+             */
+        void SetTarget(T target) {
+            // Store the new target and forget the old target's position
+            target_ = std::move(target);
+            target_binding_ = utility::EnumBinding();
+        };
+
             /// The identifying name of the target Fact.
         std::string fact_;
 
+            /// The cached FactHandle of the target Fact, bound on the first lookup.
+        facts::FactBinding binding_;
+
             /// The symbolic representation of the Condition's operation to perform.
         ConditionType condition_;
 
-            /// The target value for the Condition's test.
+            /**
+             * @brief The target value for the Condition's test.
+             * @warning Use SetTarget() to edit the target of an existing Condition!
+             */
         T target_;
 
+            /// The cached position of an enum target_ in the Fact's DynamicEnum, only used by enum Conditions.
+        utility::EnumBinding target_binding_;
+
             /**
              * @brief A flag to indicate if the Condition's Test outcomes should be inverted.
              * True to invert the Test results, False to not invert the Test results.
@@ -107,7 +128,7 @@ namespace expert_system::knowledge::rules {
 
         /// Boolean specialization overload of templated Condition::Test.
     template<>
-    TestOutcome Condition<bool>::Test(facts::FactDatabase& source) {
+    inline TestOutcome Condition<bool>::Test(const facts::FactDatabase& source) {
         // Check that the specified condition is valid
         if (condition_ == ConditionType::kUnknown) {
             // Catch and indicate failure
@@ -115,7 +136,7 @@ namespace expert_system::knowledge::rules {
         }
 
         // Check the specified Fact exists
-        auto find_result = source.Find(fact_);
+        auto find_result = source.Find(fact_, binding_);
         if (find_result == std::nullopt) {
             // Catch and indicate failure
             return TestOutcome::kInvalidFactIdentifier;
@@ -127,9 +148,8 @@ namespace expert_system::knowledge::rules {
             return TestOutcome::kInvalidFactType;
         }
 
-        // Gather the raw Fact's Value
-        auto& raw_fact = std::get<facts::BoolFact>(find_result->get().fact_);
-        auto fact_value = raw_fact.GetValue();
+        // Gather the Fact's session Value
+        auto fact_value = source.GetValue<bool>(binding_.handle_);
         if (fact_value == std::nullopt) {
             // Catch and indicate failure
             return TestOutcome::kUnknownFactValue;
@@ -217,7 +237,7 @@ namespace expert_system::knowledge::rules {
 
         /// Integer specialization overload of templated Antecedent::Test.
     template<>
-    TestOutcome Condition<int>::Test(facts::FactDatabase& source) {
+    inline TestOutcome Condition<int>::Test(const facts::FactDatabase& source) {
         // Check that the specified condition is valid
         if (condition_ == ConditionType::kUnknown) {
             // Catch and indicate failure
@@ -225,7 +245,7 @@ namespace expert_system::knowledge::rules {
         }
 
         // Check the specified Fact exists
-        auto find_result = source.Find(fact_);
+        auto find_result = source.Find(fact_, binding_);
         if (find_result == std::nullopt) {
             // Catch and indicate failure
             return TestOutcome::kInvalidFactIdentifier;
@@ -237,9 +257,8 @@ namespace expert_system::knowledge::rules {
             return TestOutcome::kInvalidFactType;
         }
 
-        // Gather the raw Fact's Value
-        auto& raw_fact = std::get<facts::IntFact>(find_result->get().fact_);
-        auto fact_value = raw_fact.GetValue();
+        // Gather the Fact's session Value
+        auto fact_value = source.GetValue<int>(binding_.handle_);
         if (fact_value == std::nullopt) {
             // Catch and indicate failure
             return TestOutcome::kUnknownFactValue;
@@ -321,7 +340,7 @@ namespace expert_system::knowledge::rules {
 
         /// Float specialization overload of templated Antecedent::Test.
     template<>
-    TestOutcome Condition<float>::Test(facts::FactDatabase& source) {
+    inline TestOutcome Condition<float>::Test(const facts::FactDatabase& source) {
         // Check that the specified condition is valid
         if (condition_ == ConditionType::kUnknown) {
             // Catch and indicate failure
@@ -329,7 +348,7 @@ namespace expert_system::knowledge::rules {
         }
 
         // Check the specified Fact exists
-        auto find_result = source.Find(fact_);
+        auto find_result = source.Find(fact_, binding_);
         if (find_result == std::nullopt) {
             // Catch and indicate failure
             return TestOutcome::kInvalidFactIdentifier;
@@ -341,9 +360,8 @@ namespace expert_system::knowledge::rules {
             return TestOutcome::kInvalidFactType;
         }
 
-        // Gather the raw Fact's Value
-        auto& raw_fact = std::get<facts::FloatFact>(find_result->get().fact_);
-        auto fact_value = raw_fact.GetValue();
+        // Gather the Fact's session Value
+        auto fact_value = source.GetValue<float>(binding_.handle_);
         if (fact_value == std::nullopt) {
             // Catch and indicate failure
             return TestOutcome::kUnknownFactValue;
@@ -424,7 +442,7 @@ namespace expert_system::knowledge::rules {
     }
 
     template<>
-    TestOutcome Condition<std::string>::Test(facts::FactDatabase& source) {
+    inline TestOutcome Condition<std::string>::Test(const facts::FactDatabase& source) {
         // Check that the specified condition is valid
         if (condition_ == ConditionType::kUnknown) {
             // Catch and indicate failure
@@ -432,7 +450,7 @@ namespace expert_system::knowledge::rules {
         }
 
         // Check the specified Fact exists
-        auto find_result = source.Find(fact_);
+        auto find_result = source.Find(fact_, binding_);
         if (find_result == std::nullopt) {
             // Catch and indicate failure
             return TestOutcome::kInvalidFactIdentifier;
@@ -444,20 +462,22 @@ namespace expert_system::knowledge::rules {
             return TestOutcome::kInvalidFactType;
         }
 
-        // Gather the raw Fact's Value
+        // Gather the Fact's session Value, stored as an enum index
         auto& raw_fact = std::get<facts::EnumFact>(find_result->get().fact_);
-        auto fact_value = raw_fact.fact_.GetValue();
+        auto fact_value = source.GetValue<int>(binding_.handle_);
         if (fact_value == std::nullopt) {
             // Catch and indicate failure
             return TestOutcome::kUnknownFactValue;
         }
 
+        // Resolve the target's position, which is only looked up again once the Fact's enum values change
+        auto target_position = raw_fact.enum_.At(target_, target_binding_);
+
         // Test the Antecedent
-        auto& fact_enum = raw_fact.enum_;
         switch(condition_) {
             case ConditionType::kEqualTo: {
                 // Perform the test and return the result
-                if (fact_value->value_ == fact_enum.At(target_)) {
+                if (fact_value->value_ == target_position) {
                     // Catch if the result should be inverted
                     if (invert_) {
                         // Indicate failed test, return test result
@@ -479,7 +499,7 @@ namespace expert_system::knowledge::rules {
             }
             case ConditionType::kLessThan: {
                 // Perform the test and return the result
-                if (fact_enum.At(target_) < fact_value->value_) {
+                if (target_position < fact_value->value_) {
                     // Catch if the result should be inverted
                     if (invert_) {
                         // Indicate failed test, return test result
@@ -501,7 +521,7 @@ namespace expert_system::knowledge::rules {
             }
             case ConditionType::kGreaterThan: {
                 // Perform the test and return the result
-                if (fact_value->value_ < fact_enum.At(target_)) {
+                if (fact_value->value_ < target_position) {
                     // Catch if the result should be inverted
                     if (invert_) {
                         // Indicate failed test, return test result
@@ -1,5 +1,6 @@
 #include "Conditions.hpp"
 
+#include "utility/Counters.hpp"
 #include "utility/SymbolsJSON.hpp"
 
 namespace expert_system::knowledge::rules {
@@ -37,7 +38,10 @@ namespace expert_system::knowledge::rules {
         }
     }
 
-    TestOutcome VariantCondition::Test(facts::FactDatabase& source) {
+    TestOutcome VariantCondition::Test(const facts::FactDatabase& source) {
+        // Count the evaluation
+        utility::Count(utility::Counter::kConditionsEvaluated);
+
         // Attempt to gather the raw Condition
         switch (type_) {
             case utility::ExpertSystemTypes::kBool: {
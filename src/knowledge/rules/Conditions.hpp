@@ -45,7 +45,7 @@ namespace expert_system::knowledge::rules {
              * @return A TestOutcome enum symbol indicating the test's result.
              * @note This will return TestOutcome::kUnknown if no Condition is stored.
              */
-        TestOutcome Test(facts::FactDatabase& source);
+        TestOutcome Test(const facts::FactDatabase& source);
 
             /**
              * @brief Provides read-only access to the encapsulated Condition's Fact identifier.
@@ -2,48 +2,60 @@
 
 #include <variant>
 
+#include "utility/Counters.hpp"
 #include "utility/SymbolsJSON.hpp"
 
 namespace expert_system::knowledge::rules {
 
-    Rule::Rule() : successful_response_(false) {};
+    Rule::Rule() : successful_response_(false), priority_(0) {};
+
+    const std::set<std::string>& Rule::TriggerFacts() {
+        // Provide the cached Fact names, if they have been gathered
+        if (trigger_facts_.has_value()) {
+            return trigger_facts_.value();
+        }
 
-    std::set<std::string> Rule::TriggerFacts() {
         // Keep track of the Fact names
-        std::set<std::string> fact_names;
+        auto& fact_names = trigger_facts_.emplace();
 
         // Check if the Rule's root Condition actually has an assigned target Fact
         auto root_condition_fact = trigger_.root_condition_.Fact();
         if (!root_condition_fact.has_value()) {
             // Catch the invalid Condition and indicate the Antecedent is invalid
-            return std::set<std::string>();
+            return fact_names;
         }
 
         // Store the root Condition's target Fact name
-        fact_names.insert(trigger_.root_condition_.Fact().value());
+        fact_names.insert(root_condition_fact.value());
 
         // Iterate through the Antecedent's chain of Conditions
-        for (auto current_condition: trigger_.condition_chain_) {
+        for (auto& current_condition: trigger_.condition_chain_) {
             // Attempt to gather the current Condition's
             auto condition_fact_name = current_condition.second.Fact();
 
             // Check that the current Condition actually has an assigned target Fact
             if (!condition_fact_name.has_value()) {
-                // Catch the invalid Condition and just return an empty set
-                return std::set<std::string>();
+                // Catch the invalid Condition and just provide an empty set
+                fact_names.clear();
+                return fact_names;
             }
 
             // Store the current Condition's target Fact name
             fact_names.insert(condition_fact_name.value());
         }
 
-        // Return the set of Fact names
+        // Provide the set of Fact names
         return fact_names;
     }
 
-    std::set<std::string> Rule::ResponseFacts() {
+    const std::set<std::string>& Rule::ResponseFacts() {
+        // Provide the cached Fact names, if they have been gathered
+        if (response_facts_.has_value()) {
+            return response_facts_.value();
+        }
+
         // Keep track of the Fact names
-        std::set<std::string> fact_names;
+        auto& fact_names = response_facts_.emplace();
 
         // Iterate through the Consequent's list of Assignments
         for (auto& current_assignment: response_.assignments_) {
@@ -53,21 +65,25 @@ namespace expert_system::knowledge::rules {
                     // Gather the raw Assignment and store its target Fact's name
                     auto& raw_assignment = std::get<BoolAssignment>(current_assignment.assignment_);
                     fact_names.insert(raw_assignment.fact_);
+                    break;
                 }
                 case utility::ExpertSystemTypes::kInt: {
                     // Gather the raw Assignment and store its target Fact's name
                     auto& raw_assignment = std::get<IntAssignment>(current_assignment.assignment_);
                     fact_names.insert(raw_assignment.fact_);
+                    break;
                 }
                 case utility::ExpertSystemTypes::kFloat: {
                     // Gather the raw Assignment and store its target Fact's name
                     auto& raw_assignment = std::get<FloatAssignment>(current_assignment.assignment_);
                     fact_names.insert(raw_assignment.fact_);
+                    break;
                 }
                 case utility::ExpertSystemTypes::kEnum: {
                     // Gather the raw Assignment and store its target Fact's name
                     auto& raw_assignment = std::get<EnumAssignment>(current_assignment.assignment_);
                     fact_names.insert(raw_assignment.fact_);
+                    break;
                 }
                 default: {
                     // Just skip this one
@@ -76,10 +92,16 @@ namespace expert_system::knowledge::rules {
             }
         }
 
-        // Return the set of Fact names
+        // Provide the set of Fact names
         return fact_names;
     }
 
+    void Rule::InvalidateFacts() {
+        // Discard both of the cached sets
+        trigger_facts_.reset();
+        response_facts_.reset();
+    }
+
     TestOutcome Rule::Run(facts::FactDatabase& database) {
         // Run the Antecedent to identify if the Consequent should be triggered
         auto result = trigger_.Test(database);
@@ -94,6 +116,18 @@ namespace expert_system::knowledge::rules {
         return result;
     }
 
+    TestOutcome Rule::Test(const facts::FactDatabase& database, EvaluationMode mode) {
+        // Test the Antecedent, keeping track of any skipped Conditions
+        std::size_t skipped_conditions = 0;
+        auto result = trigger_.Test(database, mode, skipped_conditions);
+
+        // Record the Test
+        utility::Count(utility::Counter::kRulesTested);
+        ++statistics_.tests_;
+        statistics_.skipped_conditions_ += skipped_conditions;
+        return result;
+    }
+
     void Rule::SetDescription(std::string description) {
         // Trim the whitespace from the front of the description
         description.erase(description.begin(),
@@ -111,7 +145,7 @@ namespace expert_system::knowledge::rules {
         description_ = description;
     }
 
-    std::string Rule::GetDescription() {
+    std::string Rule::GetDescription() const {
         // Simply provide a copy of the stored string
         return description_;
     }
@@ -125,6 +159,9 @@ namespace expert_system::knowledge::rules {
 
         // Export the description
         json_sys[utility::JSON_ID_DESCRIPTION] = target.description_;
+
+        // Export the priority
+        json_sys[utility::JSON_ID_PRIORITY] = target.priority_;
     }
 
     void from_json(const nlohmann::json& json_sys, Rule& target) {
@@ -157,6 +194,15 @@ namespace expert_system::knowledge::rules {
                 target.SetDescription(json_sys.at(utility::JSON_ID_DESCRIPTION).get<std::string>());
             }
         }
+
+        // Attempt to find the Rule's priority, older files have none
+        if (json_sys.find(utility::JSON_ID_PRIORITY) != json_sys.end()) {
+            // Attempt to gather the priority
+            if (json_sys.at(utility::JSON_ID_PRIORITY).is_number_integer()) {
+                // Store the priority
+                target.priority_ = json_sys.at(utility::JSON_ID_PRIORITY).get<int>();
+            }
+        }
     }
 
 } // namespace expert_system::knowledge::rules
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <optional>
 #include <set>
 #include <string>
@@ -9,6 +10,15 @@
 
 namespace expert_system::knowledge::rules {
 
+        /// Statistics on the Tests of a Rule's Antecedent.
+    struct RuleStatistics {
+            /// The amount of times the Antecedent has been tested.
+        std::size_t tests_ = 0;
+
+            /// The total amount of Conditions that were not tested due to short-circuiting.
+        std::size_t skipped_conditions_ = 0;
+    };
+
         /**
          * @brief An expert system Rule, composed of a Antecedent and Consequent.
          * Manages the process of running individual expert system Rules.
@@ -22,17 +32,26 @@ namespace expert_system::knowledge::rules {
              * @brief Gathers the identifiers of the Facts required to trigger this Rule.
              * @return A set of the Antecedent's target Fact names, or an empty set if the Rule's Antecedent is invalid.
              * @note All of these Facts must have a known session value to trigger the Rule.
+             * @note The set is cached on the first call, see InvalidateFacts().
              * @warning No tests will be performed to check that these Fact names are valid!
              */
-        std::set<std::string> TriggerFacts();
+        const std::set<std::string>& TriggerFacts();
 
             /**
              * @brief Gathers the identifiers of the Facts that would be assigned a session value by this Rule.
              * @return A set of the Consequent's target Fact names.
              * @note This may list Facts that already have a session value.
+             * @note The set is cached on the first call, see InvalidateFacts().
              * @warning No tests will be performed to check that these Fact names are valid!
              */
-        std::set<std::string> ResponseFacts();
+        const std::set<std::string>& ResponseFacts();
+
+            /**
+             * @brief Discards the cached TriggerFacts() and ResponseFacts(), so they are gathered again when next used.
+             * @note This must be called after editing the Rule's Antecedent or Consequent in place.
+             * RuleDatabase::Reindex() calls this for the edited Rules.
+             */
+        void InvalidateFacts();
 
             /**
              * @brief Test's the Rule's Antecedent and runs its Consequent on a successful trigger.
@@ -43,6 +62,14 @@ namespace expert_system::knowledge::rules {
              */
         TestOutcome Run(facts::FactDatabase& database);
 
+            /**
+             * @brief Tests the Rule's Antecedent, recording the Test in the Rule's statistics.
+             * @param [in] database The Fact Database to operate on.
+             * @param [in] mode The Antecedent's evaluation mode, see Antecedent::Test().
+             * @return A TestOutcome enum symbol indicating the test's result.
+             */
+        TestOutcome Test(const facts::FactDatabase& database, EvaluationMode mode);
+
             /**
              * @brief Updates the Fact's description.
              * @param [in] description A string containing a description of the Fact.
@@ -54,7 +81,7 @@ namespace expert_system::knowledge::rules {
              * @brief Gathers the Fact's description.
              * @return A copy of description_.
              */
-        std::string GetDescription();
+        std::string GetDescription() const;
 
             /// The trigger component of the expert system Rule.
         Antecedent trigger_;
@@ -65,6 +92,15 @@ namespace expert_system::knowledge::rules {
             /// Tracks if the Rule's Consequent has been run.
         bool successful_response_;
 
+            /// Statistics on the Rule's Tests, not saved with the Rule.
+        RuleStatistics statistics_;
+
+            /**
+             * @brief The Rule's salience, used to resolve conflicts between triggered Rules.
+             * Rules with a higher priority are run first by an Agenda, defaults to 0.
+             */
+        int priority_;
+
     private:
             /**
              * @brief A filtered string containing a description of the Fact.
@@ -72,6 +108,12 @@ namespace expert_system::knowledge::rules {
              */
         std::string description_;
 
+            /// The cached result of TriggerFacts(), empty until it is first gathered.
+        std::optional<std::set<std::string>> trigger_facts_;
+
+            /// The cached result of ResponseFacts(), empty until it is first gathered.
+        std::optional<std::set<std::string>> response_facts_;
+
             /// Enables JSON serializer access to private contents
         friend void to_json(nlohmann::json& json_sys, const Rule& target);
 
@@ -1,7 +1,44 @@
 #include "RuleDatabase.hpp"
 
+#include <algorithm>
+#include <utility>
+
 namespace expert_system::knowledge::rules {
 
+    RuleDatabase::RuleDatabase(const RuleDatabase& target)
+        : managed_rules_(target.managed_rules_),
+          rule_ids_(target.rule_ids_),
+          rule_slots_(target.rule_slots_.size()),
+          ordered_ids_(target.ordered_ids_),
+          fact_readers_(target.fact_readers_),
+          fact_writers_(target.fact_writers_),
+          indexed_reads_(target.indexed_reads_),
+          indexed_writes_(target.indexed_writes_) {
+        // Point the copied RuleIds at the copied Rules
+        RebindIds();
+    }
+
+    RuleDatabase& RuleDatabase::operator=(const RuleDatabase& target) {
+        // Catch self-assignment
+        if (this == &target) {
+            return *this;
+        }
+
+        // Copy the Rules and their indexes
+        managed_rules_ = target.managed_rules_;
+        rule_ids_ = target.rule_ids_;
+        rule_slots_.assign(target.rule_slots_.size(), std::nullopt);
+        ordered_ids_ = target.ordered_ids_;
+        fact_readers_ = target.fact_readers_;
+        fact_writers_ = target.fact_writers_;
+        indexed_reads_ = target.indexed_reads_;
+        indexed_writes_ = target.indexed_writes_;
+
+        // Point the copied RuleIds at the copied Rules
+        RebindIds();
+        return *this;
+    }
+
     void RuleDatabase::Run(facts::FactDatabase& database) {
         // Iterate through the map
         for (auto current_rule: managed_rules_) {
@@ -50,6 +87,98 @@ namespace expert_system::knowledge::rules {
         return filtered_rules;
     }
 
+    std::vector<RuleId> RuleDatabase::ListRuleIds(RuleFilter filter) const {
+        // Keep track of the RuleIds
+        std::vector<RuleId> filtered_ids;
+        filtered_ids.reserve(ordered_ids_.size());
+
+        // Iterate through the stored Rules, in the order of their names
+        for (auto current_id: ordered_ids_) {
+            // Split logic based on the requested filter
+            const auto& current_rule = rule_slots_[current_id].value()->second;
+            switch (filter) {
+                case RuleFilter::kAll: {
+                    // Just add the RuleId to the list
+                    filtered_ids.push_back(current_id);
+                    break;
+                }
+                case RuleFilter::kHasNotRunConsequent: {
+                    // Check the Rule's flag member
+                    if (!current_rule.successful_response_) {
+                        // Add the RuleId to the list
+                        filtered_ids.push_back(current_id);
+                    }
+                    break;
+                }
+                case RuleFilter::kHasRunConsequent: {
+                    // Check the Rule's flag member
+                    if (current_rule.successful_response_) {
+                        // Add the RuleId to the list
+                        filtered_ids.push_back(current_id);
+                    }
+                    break;
+                }
+            }
+        }
+
+        // Return the list of RuleIds
+        return filtered_ids;
+    }
+
+    std::optional<RuleId> RuleDatabase::Id(const std::string& name) const {
+        // Attempt to find the name's RuleId
+        auto search_result = rule_ids_.find(name);
+        if (search_result == rule_ids_.end()) {
+            // Indicate failure
+            return std::nullopt;
+        }
+        return search_result->second;
+    }
+
+    std::optional<std::reference_wrapper<Rule>> RuleDatabase::Find(RuleId id) {
+        // Catch an invalid RuleId, or a removed Rule
+        if ((id >= rule_slots_.size()) || !rule_slots_[id].has_value()) {
+            // Stop and indicate failure
+            return std::nullopt;
+        }
+
+        // Gather a reference to the Rule
+        return rule_slots_[id].value()->second;
+    }
+
+    std::optional<std::reference_wrapper<const Rule>> RuleDatabase::Find(RuleId id) const {
+        // Catch an invalid RuleId, or a removed Rule
+        if ((id >= rule_slots_.size()) || !rule_slots_[id].has_value()) {
+            // Stop and indicate failure
+            return std::nullopt;
+        }
+
+        // Gather a const reference to the Rule
+        return rule_slots_[id].value()->second;
+    }
+
+    std::optional<std::reference_wrapper<const std::string>> RuleDatabase::Name(RuleId id) const {
+        // Catch an invalid RuleId, or a removed Rule
+        if ((id >= rule_slots_.size()) || !rule_slots_[id].has_value()) {
+            // Stop and indicate failure
+            return std::nullopt;
+        }
+
+        // Gather a reference to the name
+        return rule_slots_[id].value()->first;
+    }
+
+    std::optional<std::map<std::string, Rule>::iterator> RuleDatabase::Iterator(RuleId id) {
+        // Catch an invalid RuleId, or a removed Rule
+        if (id >= rule_slots_.size()) {
+            // Stop and indicate failure
+            return std::nullopt;
+        }
+
+        // Provide the iterator, if the Rule is still stored
+        return rule_slots_[id];
+    }
+
     std::set<std::string> RuleDatabase::ListRuleAntedecentFacts(
             RuleFilter filter) {
         // Keep track of the Fact names
@@ -60,23 +189,26 @@ namespace expert_system::knowledge::rules {
             // Split logic based on the requested filter
             switch (filter) {
                 case RuleFilter::kAll: {
-                    // Just add the iterator to the list
-                    fact_names.merge(current_rule->second.TriggerFacts());
+                    // Just add the Rule's Fact names
+                    const auto& rule_facts = current_rule->second.TriggerFacts();
+                    fact_names.insert(rule_facts.begin(), rule_facts.end());
                     break;
                 }
                 case RuleFilter::kHasNotRunConsequent: {
                     // Check the Rule's flag member
                     if (!current_rule->second.successful_response_) {
-                        // Add the iterator to the list
-                        fact_names.merge(current_rule->second.TriggerFacts());
+                        // Add the Rule's Fact names
+                        const auto& rule_facts = current_rule->second.TriggerFacts();
+                        fact_names.insert(rule_facts.begin(), rule_facts.end());
                     }
                     break;
                 }
                 case RuleFilter::kHasRunConsequent: {
                     // Check the Rule's flag member
                     if (current_rule->second.successful_response_) {
-                        // Add the iterator to the list
-                        fact_names.merge(current_rule->second.TriggerFacts());
+                        // Add the Rule's Fact names
+                        const auto& rule_facts = current_rule->second.TriggerFacts();
+                        fact_names.insert(rule_facts.begin(), rule_facts.end());
                     }
                     break;
                 }
@@ -97,22 +229,28 @@ namespace expert_system::knowledge::rules {
             // Split logic based on the requested filter
             switch (filter) {
                 case RuleFilter::kAll: {
-                    // Just add the iterator to the list
-                    fact_names.merge(current_rule->second.ResponseFacts());
+                    // Just add the Rule's Fact names
+                    const auto& rule_facts = current_rule->second.ResponseFacts();
+                    fact_names.insert(rule_facts.begin(), rule_facts.end());
+                    break;
                 }
                 case RuleFilter::kHasNotRunConsequent: {
                     // Check the Rule's flag member
                     if (!current_rule->second.successful_response_) {
-                        // Add the iterator to the list
-                        fact_names.merge(current_rule->second.ResponseFacts());
+                        // Add the Rule's Fact names
+                        const auto& rule_facts = current_rule->second.ResponseFacts();
+                        fact_names.insert(rule_facts.begin(), rule_facts.end());
                     }
+                    break;
                 }
                 case RuleFilter::kHasRunConsequent: {
                     // Check the Rule's flag member
                     if (current_rule->second.successful_response_) {
-                        // Add the iterator to the list
-                        fact_names.merge(current_rule->second.ResponseFacts());
+                        // Add the Rule's Fact names
+                        const auto& rule_facts = current_rule->second.ResponseFacts();
+                        fact_names.insert(rule_facts.begin(), rule_facts.end());
                     }
+                    break;
                 }
             }
         }
@@ -123,12 +261,222 @@ namespace expert_system::knowledge::rules {
 
     void RuleDatabase::ResetRules() {
         // Iterate through all of the Rules
-        for (auto current_rule: managed_rules_) {
+        for (auto& current_rule: managed_rules_) {
             // Just set the flag to false
             current_rule.second.successful_response_ = false;
         }
     }
 
+    void RuleDatabase::ResetStatistics() {
+        // Iterate through all of the Rules
+        for (auto& current_rule: managed_rules_) {
+            // Just replace the statistics
+            current_rule.second.statistics_ = RuleStatistics();
+        }
+    }
+
+    bool RuleDatabase::Insert(const std::string& name, Rule rule) {
+        // Catch if the name is already used
+        if (managed_rules_.find(name) != managed_rules_.end()) {
+            // Stop and indicate failure
+            return false;
+        }
+
+        // Store the Rule, then assign its RuleId and index its Facts
+        auto new_rule = managed_rules_.emplace(name, std::move(rule)).first;
+        AssignId(new_rule);
+        IndexRule(name);
+        return true;
+    }
+
+    bool RuleDatabase::Remove(const std::string& name) {
+        // Catch if the name is not used
+        if (managed_rules_.find(name) == managed_rules_.end()) {
+            // Stop and indicate failure
+            return false;
+        }
+
+        // Remove the Rule from the index, release its RuleId and delete it
+        UnindexRule(name);
+        ReleaseId(name);
+        managed_rules_.erase(name);
+        return true;
+    }
+
+    void RuleDatabase::Reindex(const std::string& name) {
+        // Discard the Rule's outdated entries
+        UnindexRule(name);
+
+        // Release the RuleId of a Rule that no longer exists
+        auto search_result = managed_rules_.find(name);
+        if (search_result == managed_rules_.end()) {
+            ReleaseId(name);
+            return;
+        }
+
+        // Assign a RuleId to a new Rule, or point the existing RuleId at the Rule in case it was replaced
+        auto existing_id = rule_ids_.find(name);
+        if (existing_id == rule_ids_.end()) {
+            AssignId(search_result);
+        } else {
+            rule_slots_[existing_id->second] = search_result;
+        }
+
+        // Index the Rule again
+        IndexRule(name);
+    }
+
+    void RuleDatabase::Reindex() {
+        // Discard the entire index
+        fact_readers_.clear();
+        fact_writers_.clear();
+        indexed_reads_.clear();
+        indexed_writes_.clear();
+
+        // Keep the RuleIds of the Rules that are still stored, and assign RuleIds to the new Rules
+        RebindIds();
+        ordered_ids_.clear();
+        for (auto current_rule = managed_rules_.begin(); current_rule != managed_rules_.end(); ++current_rule) {
+            auto existing_id = rule_ids_.find(current_rule->first);
+            if (existing_id == rule_ids_.end()) {
+                AssignId(current_rule);
+            } else {
+                ordered_ids_.push_back(existing_id->second);
+            }
+        }
+
+        // Index every stored Rule
+        for (const auto& current_rule: managed_rules_) {
+            IndexRule(current_rule.first);
+        }
+    }
+
+    const std::set<std::string>& RuleDatabase::ListFactReaders(const std::string& fact_name) const {
+        // Shared result for Facts that are not read by any Rule
+        static const std::set<std::string> no_rules;
+
+        // Attempt to find the Fact in the index
+        auto search_result = fact_readers_.find(fact_name);
+        if (search_result == fact_readers_.end()) {
+            // Indicate that no Rules read the Fact
+            return no_rules;
+        }
+
+        // Return the indexed Rule names
+        return search_result->second;
+    }
+
+    const std::set<std::string>& RuleDatabase::ListFactWriters(const std::string& fact_name) const {
+        // Shared result for Facts that are not written by any Rule
+        static const std::set<std::string> no_rules;
+
+        // Attempt to find the Fact in the index
+        auto search_result = fact_writers_.find(fact_name);
+        if (search_result == fact_writers_.end()) {
+            // Indicate that no Rules write the Fact
+            return no_rules;
+        }
+
+        // Return the indexed Rule names
+        return search_result->second;
+    }
+
+    void RuleDatabase::AssignId(std::map<std::string, Rule>::iterator rule) {
+        // Intern the name to the next RuleId
+        auto new_id = static_cast<RuleId>(rule_slots_.size());
+        rule_slots_.emplace_back(rule);
+        rule_ids_.emplace(rule->first, new_id);
+
+        // Keep the RuleIds in the order of the Rules' names
+        auto position = std::lower_bound(ordered_ids_.begin(), ordered_ids_.end(), rule->first,
+                                         [this](RuleId current_id, const std::string& name) {
+                                             return rule_slots_[current_id].value()->first < name;
+                                         });
+        ordered_ids_.insert(position, new_id);
+    }
+
+    void RuleDatabase::ReleaseId(const std::string& name) {
+        // Catch a name without a RuleId
+        auto search_result = rule_ids_.find(name);
+        if (search_result == rule_ids_.end()) {
+            return;
+        }
+
+        // Empty the slot without reusing it, as the Rule may have already been deleted
+        auto released_id = search_result->second;
+        ordered_ids_.erase(std::remove(ordered_ids_.begin(), ordered_ids_.end(), released_id), ordered_ids_.end());
+        rule_slots_[released_id].reset();
+        rule_ids_.erase(search_result);
+    }
+
+    void RuleDatabase::RebindIds() {
+        // Point each RuleId at the Rule stored under its name
+        for (auto current_id = rule_ids_.begin(); current_id != rule_ids_.end();) {
+            auto search_result = managed_rules_.find(current_id->first);
+            if (search_result == managed_rules_.end()) {
+                // Release the RuleId of a Rule that is no longer stored
+                rule_slots_[current_id->second].reset();
+                ordered_ids_.erase(std::remove(ordered_ids_.begin(), ordered_ids_.end(), current_id->second),
+                                   ordered_ids_.end());
+                current_id = rule_ids_.erase(current_id);
+                continue;
+            }
+            rule_slots_[current_id->second] = search_result;
+            ++current_id;
+        }
+    }
+
+    void RuleDatabase::IndexRule(const std::string& name) {
+        // Gather the Facts that the Rule reads and writes, replacing any outdated cached sets and short-circuit points
+        auto& rule = managed_rules_.at(name);
+        rule.InvalidateFacts();
+        rule.trigger_.InvalidateShortCircuits();
+        auto read_facts = rule.TriggerFacts();
+        auto written_facts = rule.ResponseFacts();
+
+        // Map each of the Facts back to the Rule
+        for (const auto& current_fact: read_facts) {
+            fact_readers_[current_fact].insert(name);
+        }
+        for (const auto& current_fact: written_facts) {
+            fact_writers_[current_fact].insert(name);
+        }
+
+        // Remember what was indexed, so it can be removed after the Rule is edited
+        indexed_reads_[name] = std::move(read_facts);
+        indexed_writes_[name] = std::move(written_facts);
+    }
+
+    void RuleDatabase::UnindexRule(const std::string& name) {
+        // Remove the Rule from each of the Facts it was indexed as reading
+        auto read_entry = indexed_reads_.find(name);
+        if (read_entry != indexed_reads_.end()) {
+            for (const auto& current_fact: read_entry->second) {
+                // Discard the Fact's entry once no Rules read it
+                auto& readers = fact_readers_[current_fact];
+                readers.erase(name);
+                if (readers.empty()) {
+                    fact_readers_.erase(current_fact);
+                }
+            }
+            indexed_reads_.erase(read_entry);
+        }
+
+        // Remove the Rule from each of the Facts it was indexed as writing
+        auto write_entry = indexed_writes_.find(name);
+        if (write_entry != indexed_writes_.end()) {
+            for (const auto& current_fact: write_entry->second) {
+                // Discard the Fact's entry once no Rules write it
+                auto& writers = fact_writers_[current_fact];
+                writers.erase(name);
+                if (writers.empty()) {
+                    fact_writers_.erase(current_fact);
+                }
+            }
+            indexed_writes_.erase(write_entry);
+        }
+    }
+
     void to_json(nlohmann::json& json_sys, const RuleDatabase& target) {
         // Export the list of Rules
         json_sys = target.managed_rules_;
@@ -140,6 +488,9 @@ namespace expert_system::knowledge::rules {
             // Store the mapped Rules
             target.managed_rules_ = json_sys.get<std::map<std::string, Rule>>();
         }
+
+        // Rebuild the Fact dependency index for the imported Rules
+        target.Reindex();
     }
 
 } // namespace expert_system::knowledge::rules
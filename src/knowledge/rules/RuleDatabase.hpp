@@ -1,10 +1,16 @@
 #pragma once
 
+#include <functional>
 #include <list>
 #include <map>
+#include <optional>
+#include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "knowledge/rules/Rule.hpp"
+#include "knowledge/rules/RuleId.hpp"
 
 namespace expert_system::knowledge::rules {
 
@@ -18,11 +24,37 @@ namespace expert_system::knowledge::rules {
         /**
          * @brief A basic database that manages an expert system's Rules.
          * Very basic structure, but is capable of operating all of its stored Rules.
+         * Each stored Rule's name is interned to a RuleId, which is never reused for another Rule.
+         * RuleIds index a contiguous slot table, so that the inference engines can refer to Rules without iterators.
          */
     struct RuleDatabase {
             /// Default constructor
         RuleDatabase() = default;
 
+            /**
+             * @brief Copy constructor.
+             * @param [in] target The RuleDatabase to copy.
+             * @note The copy keeps the RuleIds of the original, referring to its own Rules.
+             */
+        RuleDatabase(const RuleDatabase& target);
+
+            /**
+             * @brief Copy assignment operator.
+             * @param [in] target The RuleDatabase to copy.
+             * @return A reference to this RuleDatabase.
+             * @note The copy keeps the RuleIds of the original, referring to its own Rules.
+             */
+        RuleDatabase& operator=(const RuleDatabase& target);
+
+            /// Default move constructor, the moved Rules keep their RuleIds.
+        RuleDatabase(RuleDatabase&& target) = default;
+
+            /**
+             * @brief Default move assignment operator, the moved Rules keep their RuleIds.
+             * @return A reference to this RuleDatabase.
+             */
+        RuleDatabase& operator=(RuleDatabase&& target) = default;
+
             /**
              * @brief Calls the Run() method on all stored Rules.
              * @param database The Fact Database to operate on.
@@ -37,6 +69,49 @@ namespace expert_system::knowledge::rules {
         std::list<std::map<std::string, Rule>::iterator> ListRules(
                 RuleFilter filter = RuleFilter::kAll);
 
+            /**
+             * @brief Lists the RuleIds of the stored Rules, with a specified filter.
+             * @param filter The identifier of the filter to apply.
+             * @return A list of the RuleIds of the filtered Rules, in the order of the Rules' names.
+             * @note Equivalent to ListRules(), without building a list of iterators.
+             */
+        [[nodiscard]] std::vector<RuleId> ListRuleIds(RuleFilter filter = RuleFilter::kAll) const;
+
+            /**
+             * @brief Gathers the RuleId interned for a Rule's name.
+             * @param [in] name The name of the target Rule.
+             * @return The RuleId if the Rule exists, or std::nullopt otherwise.
+             */
+        [[nodiscard]] std::optional<RuleId> Id(const std::string& name) const;
+
+            /**
+             * @brief Attempts to gather a stored Rule by RuleId.
+             * @param [in] id The RuleId of the target Rule.
+             * @return A reference to the Rule if successful, or std::nullopt otherwise.
+             */
+        std::optional<std::reference_wrapper<Rule>> Find(RuleId id);
+
+            /**
+             * @brief Attempts to gather a stored Rule by RuleId, without allowing it to be changed.
+             * @param [in] id The RuleId of the target Rule.
+             * @return A const reference to the Rule if successful, or std::nullopt otherwise.
+             */
+        [[nodiscard]] std::optional<std::reference_wrapper<const Rule>> Find(RuleId id) const;
+
+            /**
+             * @brief Gathers the name of a stored Rule.
+             * @param [in] id The RuleId of the target Rule.
+             * @return A reference to the Rule's name if successful, or std::nullopt otherwise.
+             */
+        [[nodiscard]] std::optional<std::reference_wrapper<const std::string>> Name(RuleId id) const;
+
+            /**
+             * @brief Gathers the iterator to a stored Rule, for the APIs that still refer to Rules by iterator.
+             * @param [in] id The RuleId of the target Rule.
+             * @return The iterator to the Rule if successful, or std::nullopt otherwise.
+             */
+        std::optional<std::map<std::string, Rule>::iterator> Iterator(RuleId id);
+
             /**
              * @brief Lists all of the Facts that the stored Rules require to trigger their Antecedent.
              * @param filter The identifier of the filter to apply.
@@ -56,11 +131,108 @@ namespace expert_system::knowledge::rules {
             /// Reverts the "has_run_" flag on all stored Rules.
         void ResetRules();
 
+            /// Clears the Test statistics of all stored Rules.
+        void ResetStatistics();
+
+            /**
+             * @brief Attempts to store a new Rule, adding it to the Fact dependency index.
+             * @param [in] name The unique name of the new Rule.
+             * @param [in] rule The Rule to store.
+             * @return True if the Rule was stored, False otherwise.
+             * @note This will fail if the provided name is already in use.
+             */
+        bool Insert(const std::string& name, Rule rule);
+
+            /**
+             * @brief Attempts to delete a stored Rule, removing it from the Fact dependency index.
+             * @param [in] name The name of the target Rule.
+             * @return True if the Rule was found and deleted, False otherwise.
+             */
+        bool Remove(const std::string& name);
+
+            /**
+             * @brief Updates the Fact dependency index and RuleId after a stored Rule has been edited.
+             * @param [in] name The name of the edited Rule.
+             * @note This must be called after editing a Rule's Antecedent or Consequent in place.
+             */
+        void Reindex(const std::string& name);
+
+            /**
+             * @brief Rebuilds the entire Fact dependency index and RuleId table from the stored Rules.
+             * Rules that are still stored under the same name keep their RuleId.
+             * @note This must be called after editing managed_rules_ directly.
+             */
+        void Reindex();
+
+            /**
+             * @brief Lists the Rules with an Antecedent that reads a specified Fact.
+             * @param [in] fact_name The name of the target Fact.
+             * @return A read-only set of the Rule names, which is empty if no Rules read the Fact.
+             */
+        const std::set<std::string>& ListFactReaders(const std::string& fact_name) const;
+
+            /**
+             * @brief Lists the Rules with a Consequent that writes a specified Fact.
+             * @param [in] fact_name The name of the target Fact.
+             * @return A read-only set of the Rule names, which is empty if no Rules write the Fact.
+             */
+        const std::set<std::string>& ListFactWriters(const std::string& fact_name) const;
+
             /**
              * @brief The database's collection of Rules.
              * Maps a Rule to a unique name.
+             * @warning Call Reindex() after inserting, removing or editing Rules directly!
              */
         std::map<std::string, Rule> managed_rules_;
+
+    private:
+            /**
+             * @brief Adds a stored Rule to the Fact dependency index.
+             * @param [in] name The name of the target Rule.
+             */
+        void IndexRule(const std::string& name);
+
+            /**
+             * @brief Removes a Rule from the Fact dependency index.
+             * @param [in] name The name of the target Rule.
+             */
+        void UnindexRule(const std::string& name);
+
+            /**
+             * @brief Assigns the next RuleId to a stored Rule.
+             * @param [in] rule The iterator to the stored Rule.
+             */
+        void AssignId(std::map<std::string, Rule>::iterator rule);
+
+            /**
+             * @brief Releases the RuleId of a Rule, leaving its slot empty.
+             * @param [in] name The name of the target Rule.
+             */
+        void ReleaseId(const std::string& name);
+
+            /// Points each occupied slot at the Rule stored under its name, releasing the slots of missing Rules.
+        void RebindIds();
+
+            /// Maps a Rule's name to its RuleId.
+        std::unordered_map<std::string, RuleId> rule_ids_;
+
+            /// The stored Rule for each RuleId, which is empty once the Rule has been removed.
+        std::vector<std::optional<std::map<std::string, Rule>::iterator>> rule_slots_;
+
+            /// The RuleIds of the stored Rules, in the order of the Rules' names.
+        std::vector<RuleId> ordered_ids_;
+
+            /// Maps a Fact's name to the names of the Rules with an Antecedent that reads it.
+        std::unordered_map<std::string, std::set<std::string>> fact_readers_;
+
+            /// Maps a Fact's name to the names of the Rules with a Consequent that writes it.
+        std::unordered_map<std::string, std::set<std::string>> fact_writers_;
+
+            /// Maps a Rule's name to the Facts it was indexed as reading.
+        std::unordered_map<std::string, std::set<std::string>> indexed_reads_;
+
+            /// Maps a Rule's name to the Facts it was indexed as writing.
+        std::unordered_map<std::string, std::set<std::string>> indexed_writes_;
     };
 
         /**
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+namespace expert_system::knowledge::rules {
+
+        /**
+         * @brief A dense integer identifier for a Rule, interned from its name by a RuleDatabase.
+         * A RuleId stays valid while its Rule is stored, and is never reused for another Rule.
+         * @warning A RuleId is only meaningful to the RuleDatabase that issued it, or to a copy of it!
+         */
+    using RuleId = std::uint32_t;
+
+        /// The RuleId that never identifies a Rule.
+    constexpr RuleId kInvalidRuleId = std::numeric_limits<RuleId>::max();
+
+} // namespace expert_system::knowledge::rules
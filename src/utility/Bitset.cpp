@@ -0,0 +1,81 @@
+#include "Bitset.hpp"
+
+#include <bitset>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace expert_system::utility {
+
+    void Bitset::Resize(std::size_t size) {
+        // Catch if the Bitset is shrinking, and discount the set bits that will be cut off
+        if (size < size_) {
+            for (std::size_t index = size; index < size_; index++) {
+                Reset(index);
+            }
+        }
+
+        // Resize the words, new bits start unset
+        size_ = size;
+        words_.resize((size + kWordBits - 1) / kWordBits, 0);
+    }
+
+    std::size_t Bitset::Size() const {
+        // Provide the amount of bits
+        return size_;
+    }
+
+    bool Bitset::Set(std::size_t index) {
+        // Catch a bit outside of the Bitset, or a bit that is already set
+        if ((index >= size_) || Test(index)) {
+            return false;
+        }
+
+        // Set the bit and count it
+        words_[index / kWordBits] |= (std::uint64_t(1) << (index % kWordBits));
+        count_++;
+        return true;
+    }
+
+    bool Bitset::Reset(std::size_t index) {
+        // Catch a bit outside of the Bitset, or a bit that is already unset
+        if (!Test(index)) {
+            return false;
+        }
+
+        // Unset the bit and discount it
+        words_[index / kWordBits] &= ~(std::uint64_t(1) << (index % kWordBits));
+        count_--;
+        return true;
+    }
+
+    void Bitset::ResetAll() {
+        // Unset every word
+        for (auto& current_word: words_) {
+            current_word = 0;
+        }
+        count_ = 0;
+    }
+
+    std::size_t Bitset::Count() const {
+        // Provide the running count
+        return count_;
+    }
+
+    std::size_t Bitset::LowestBit(std::uint64_t word) {
+#if defined(_MSC_VER)
+        // Use the compiler's bit scan
+        unsigned long bit_index = 0;
+        _BitScanForward64(&bit_index, word);
+        return bit_index;
+#elif defined(__GNUC__)
+        // Use the compiler's trailing zero count
+        return (std::size_t) __builtin_ctzll(word);
+#else
+        // Count the bits below the lowest set bit
+        return std::bitset<kWordBits>((word & -word) - 1).count();
+#endif
+    }
+
+} // namespace expert_system::utility
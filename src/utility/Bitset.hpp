@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace expert_system::utility {
+
+        /**
+         * @brief A resizable set of bits, which keeps a running count of its set bits.
+         * Supports iterating over the set bits a word at a time, skipping the unset bits.
+         */
+    class Bitset {
+    public:
+            /// Default constructor, creates an empty Bitset.
+        Bitset() = default;
+
+            /**
+             * @brief Changes the amount of bits.
+             * @param [in] size The new amount of bits.
+             * @note New bits start unset, and set bits that are cut off are discounted.
+             */
+        void Resize(std::size_t size);
+
+            /**
+             * @brief Gathers the amount of bits.
+             * @return The amount of bits.
+             */
+        [[nodiscard]] std::size_t Size() const;
+
+            /**
+             * @brief Checks if a bit is set.
+             * @param [in] index The index of the bit.
+             * @return True if the bit exists and is set, False otherwise.
+             */
+        [[nodiscard]] bool Test(std::size_t index) const {
+            // Catch a bit outside of the Bitset
+            if (index >= size_) {
+                return false;
+            }
+
+            // Check the bit within its word
+            return (words_[index / kWordBits] >> (index % kWordBits)) & 1u;
+        }
+
+            /**
+             * @brief Sets a bit.
+             * @param [in] index The index of the bit.
+             * @return True if the bit was changed, False if it was already set or does not exist.
+             */
+        bool Set(std::size_t index);
+
+            /**
+             * @brief Unsets a bit.
+             * @param [in] index The index of the bit.
+             * @return True if the bit was changed, False if it was already unset or does not exist.
+             */
+        bool Reset(std::size_t index);
+
+            /// Unsets every bit, without changing the amount of bits.
+        void ResetAll();
+
+            /**
+             * @brief Gathers the amount of set bits.
+             * @return The amount of set bits.
+             * @note The count is kept up to date by every change, so this does not scan the bits.
+             */
+        [[nodiscard]] std::size_t Count() const;
+
+            /**
+             * @brief Passes the index of each set bit to a function, in ascending order.
+             * @tparam Function A callable taking a std::size_t index.
+             * @param [in] function The function to call for each set bit.
+             */
+        template<class Function>
+        void ForEach(Function&& function) const {
+            // Iterate through the words, skipping the empty ones
+            for (std::size_t word_index = 0; word_index < words_.size(); word_index++) {
+                auto current_word = words_[word_index];
+                while (current_word != 0) {
+                    // Pass the lowest set bit, and then clear it
+                    function(word_index * kWordBits + LowestBit(current_word));
+                    current_word &= current_word - 1;
+                }
+            }
+        }
+
+            /**
+             * @brief Passes the index of each bit that is set in this Bitset but not in another, in ascending order.
+             * @tparam Function A callable taking a std::size_t index.
+             * @param [in] excluded The Bitset of the bits to skip, which may have a different size.
+             * @param [in] function The function to call for each matching bit.
+             */
+        template<class Function>
+        void ForEachExcept(const Bitset& excluded, Function&& function) const {
+            // Iterate through the words, masking out the excluded bits
+            for (std::size_t word_index = 0; word_index < words_.size(); word_index++) {
+                auto current_word = words_[word_index];
+                if (word_index < excluded.words_.size()) {
+                    current_word &= ~excluded.words_[word_index];
+                }
+                while (current_word != 0) {
+                    // Pass the lowest matching bit, and then clear it
+                    function(word_index * kWordBits + LowestBit(current_word));
+                    current_word &= current_word - 1;
+                }
+            }
+        }
+
+    private:
+            /// The amount of bits in each word.
+        static constexpr std::size_t kWordBits = 64;
+
+            /**
+             * @brief Finds the index of the lowest set bit in a word.
+             * @param [in] word The word, which must not be 0.
+             * @return The index of the lowest set bit.
+             */
+        static std::size_t LowestBit(std::uint64_t word);
+
+            /// The bits, packed into words from the lowest bit up.
+        std::vector<std::uint64_t> words_;
+
+            /// The amount of bits.
+        std::size_t size_ = 0;
+
+            /// The amount of set bits.
+        std::size_t count_ = 0;
+    };
+
+} // namespace expert_system::utility
@@ -0,0 +1,38 @@
+#include "Counters.hpp"
+
+#include <string>
+
+namespace expert_system::utility {
+
+    std::uint64_t Counters::Get(Counter counter) const {
+        // Provide the count
+        return counts_[static_cast<std::size_t>(counter)];
+    }
+
+    void Counters::Merge(const Counters& other) {
+        // Add each of the other counts
+        for (std::size_t counter_index = 0; counter_index < counts_.size(); ++counter_index) {
+            counts_[counter_index] += other.counts_[counter_index];
+        }
+    }
+
+    void to_json(nlohmann::json& json_sys, const Counters& target) {
+        // Export each count by the Counter's name
+        json_sys = nlohmann::json::object();
+        for (std::size_t counter_index = 0; counter_index < static_cast<std::size_t>(Counter::kCount); ++counter_index) {
+            auto counter = static_cast<Counter>(counter_index);
+            json_sys[nlohmann::json(counter).get<std::string>()] = target.Get(counter);
+        }
+    }
+
+    CounterScope::CounterScope(Counters* counters) : previous_(active_) {
+        // Activate the Counters on this thread
+        active_ = counters;
+    }
+
+    CounterScope::~CounterScope() {
+        // Restore the previously active Counters
+        active_ = previous_;
+    }
+
+} // namespace expert_system::utility
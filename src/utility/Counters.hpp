@@ -0,0 +1,131 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "nlohmann/json.hpp"
+
+namespace expert_system::utility {
+
+        /// The symbolic representations of the events counted while consulting an expert system.
+    enum class Counter {
+        kRulesTested,
+        kConditionsEvaluated,
+        kFactLookups,
+        kAssignmentsApplied,
+        kRejectedMissingFact,
+        kRejectedTypeMismatch,
+        kRejectedOutOfRange,
+        kRejectedLowerConfidence,
+        kCount
+    };
+
+        /// JSON serialization for the Counter enum.
+    NLOHMANN_JSON_SERIALIZE_ENUM(Counter,
+                                {{Counter::kCount, nullptr},
+                                 {Counter::kRulesTested, "RulesTested"},
+                                 {Counter::kConditionsEvaluated, "ConditionsEvaluated"},
+                                 {Counter::kFactLookups, "FactLookups"},
+                                 {Counter::kAssignmentsApplied, "AssignmentsApplied"},
+                                 {Counter::kRejectedMissingFact, "RejectedMissingFact"},
+                                 {Counter::kRejectedTypeMismatch, "RejectedTypeMismatch"},
+                                 {Counter::kRejectedOutOfRange, "RejectedOutOfRange"},
+                                 {Counter::kRejectedLowerConfidence, "RejectedLowerConfidence"}})
+
+        /**
+         * @brief A set of event counts, one for each Counter.
+         * The counts are only gathered while the Counters are active on a thread, see CounterScope.
+         */
+    class Counters {
+    public:
+            /// Default constructor, starts every count at 0.
+        Counters() = default;
+
+            /**
+             * @brief Increases a count.
+             * @param [in] counter The count to increase.
+             * @param [in] amount The amount to increase the count by.
+             */
+        void Add(Counter counter, std::uint64_t amount = 1) {
+            // Increase the count
+            counts_[static_cast<std::size_t>(counter)] += amount;
+        }
+
+            /**
+             * @brief Gathers a count.
+             * @param [in] counter The count to gather.
+             * @return The count.
+             */
+        [[nodiscard]] std::uint64_t Get(Counter counter) const;
+
+            /**
+             * @brief Adds every count from another set of Counters.
+             * @param [in] other The Counters to add.
+             */
+        void Merge(const Counters& other);
+
+    private:
+            /// The counts, indexed by Counter.
+        std::array<std::uint64_t, static_cast<std::size_t>(Counter::kCount)> counts_{};
+    };
+
+        /**
+         * @brief Counters serialization to JSON format.
+         * @param [in,out] json_sys A reference to a JSON object.
+         * @param [in] target A reference to the Counters to export.
+         * @note Exported as an object, mapping each Counter's name to its count.
+         */
+    void to_json(nlohmann::json& json_sys, const Counters& target);
+
+        /**
+         * @brief Activates a set of Counters on the current thread, until the scope ends.
+         * Scopes can be nested, the previously active Counters are restored when the scope ends.
+         */
+    class CounterScope {
+    public:
+            /**
+             * @brief Parameterized constructor, activates the Counters.
+             * @param [in] counters The Counters to increase, or nullptr to stop counting within the scope.
+             */
+        explicit CounterScope(Counters* counters);
+
+            /// Destructor, restores the previously active Counters.
+        ~CounterScope();
+
+            /// Use of copy or assignment constructors is not allowed.
+        CounterScope(const CounterScope&) = delete;
+
+            /// Use of copy or assignment constructors is not allowed.
+        CounterScope& operator=(const CounterScope&) = delete;
+
+            /**
+             * @brief Gathers the Counters that are active on the current thread.
+             * @return A pointer to the active Counters, or nullptr if nothing is being counted.
+             */
+        static Counters* Active() {
+            return active_;
+        }
+
+    private:
+            /// The Counters that were active before the scope.
+        Counters* previous_;
+
+            /// The Counters that are active on each thread.
+        static inline thread_local Counters* active_ = nullptr;
+    };
+
+        /**
+         * @brief Increases a count in the Counters that are active on the current thread.
+         * @param [in] counter The count to increase.
+         * @note This has no effect if no Counters are active, costing a single check.
+         */
+    inline void Count(Counter counter) {
+        // Only count while a CounterScope is active
+        auto active_counters = CounterScope::Active();
+        if (active_counters != nullptr) {
+            active_counters->Add(counter);
+        }
+    }
+
+} // namespace expert_system::utility
@@ -1,9 +1,31 @@
 #include "DynamicEnum.hpp"
 
+#include <atomic>
 #include <tuple>
+#include <utility>
 
 namespace expert_system::utility {
 
+    namespace {
+
+            /// The most recent revision assigned to any DynamicEnum.
+        std::atomic<std::uint64_t> latest_revision{0};
+
+            /**
+             * @brief Generates the heap priority of a treap node from its EnumId.
+             * @param [in] id The EnumId of the node.
+             * @return A well-mixed priority, so that the tree is balanced regardless of the insertion order.
+             */
+        std::uint32_t Priority(EnumId id) {
+            // Mix the bits of the EnumId (splitmix32)
+            auto mixed = id + 0x9E3779B9u;
+            mixed = (mixed ^ (mixed >> 16)) * 0x85EBCA6Bu;
+            mixed = (mixed ^ (mixed >> 13)) * 0xC2B2AE35u;
+            return mixed ^ (mixed >> 16);
+        }
+
+    } // namespace
+
     DynamicEnum::DynamicEnum(const std::list<std::string>& ordered_names) {
         // Iterate through the provided list
         for (const auto& current_name: ordered_names) {
@@ -12,6 +34,31 @@ namespace expert_system::utility {
         }
     }
 
+    DynamicEnum::DynamicEnum(DynamicEnum&& other) noexcept
+        : name_to_id_(std::move(other.name_to_id_)),
+          members_(std::move(other.members_)),
+          free_ids_(std::move(other.free_ids_)),
+          root_(std::exchange(other.root_, kInvalidEnumId)),
+          revision_(std::exchange(other.revision_, 0)) {
+        // Make sure the original matches the empty revision
+        other.name_to_id_.clear();
+        other.members_.clear();
+        other.free_ids_.clear();
+    }
+
+    DynamicEnum& DynamicEnum::operator=(DynamicEnum&& other) noexcept {
+        // Take the enum values and their revision, leaving the original empty
+        name_to_id_ = std::move(other.name_to_id_);
+        members_ = std::move(other.members_);
+        free_ids_ = std::move(other.free_ids_);
+        root_ = std::exchange(other.root_, kInvalidEnumId);
+        revision_ = std::exchange(other.revision_, 0);
+        other.name_to_id_.clear();
+        other.members_.clear();
+        other.free_ids_.clear();
+        return *this;
+    }
+
     bool DynamicEnum::PushBack(const std::string& name) {
         // Catch if the name is already used
         if (Has(name)) {
@@ -19,19 +66,16 @@ namespace expert_system::utility {
             return false;
         }
 
-        // Add the enum value to the map, storing its position
-        name_to_position_.insert(std::pair<std::string, int>(name, (int) position_to_name_.size()));
-
-        // Add the enum value to the vector, storing its map iterator
-        position_to_name_.push_back(name);
+        // Add the enum value after the existing ones
+        Attach(name, SubtreeSize(root_));
 
         // Indicate success
         return true;
     }
 
     bool DynamicEnum::Insert(const std::string& name, int position) {
-        // Catch if the requested position for the new enum is invalid or at the end of the vector
-        if ((position < 0) || ((int) name_to_position_.size() <= position)) {
+        // Catch if the requested position for the new enum is invalid or at the end of the tree
+        if ((position < 0) || (Size() <= position)) {
             // Pass the new enum value to the PushBack to handle
             return PushBack(name);
         }
@@ -42,63 +86,135 @@ namespace expert_system::utility {
             return false;
         }
 
-        // Add the enum value to the map, storing its position
-        name_to_position_.insert(std::pair<std::string, int>(name, position));
-
-        // Add the enum value to the vector, storing its map iterator
-        position_to_name_.insert(position_to_name_.begin() + position, name);
-
-        // Iterate through the vector, starting at the element first pushed forward
-        for (auto iterator = position_to_name_.begin() + position; iterator != position_to_name_.end(); ++iterator) {
-            // Increment the position value stored
-            auto current_enum_name = *iterator;
-            name_to_position_[current_enum_name] += 1;
-        }
+        // Add the enum value between its neighbours, which implicitly moves every later enum value 'up'
+        Attach(name, static_cast<std::uint32_t>(position));
 
         // Indicate success
         return true;
     }
 
-    bool DynamicEnum::Has(const std::string& name) {
+    bool DynamicEnum::Has(const std::string& name) const {
         // Search the map for an existing key identical to the provided string
-        return name_to_position_.find(name) != name_to_position_.end();
+        return name_to_id_.find(name) != name_to_id_.end();
     }
 
-    int DynamicEnum::Size() {
+    int DynamicEnum::Size() const {
         // Gather the amount of elements stored within the map
-        return (int) name_to_position_.size();
+        return (int) name_to_id_.size();
     }
 
-    std::optional<std::string> DynamicEnum::At(int position) {
+    std::optional<std::string> DynamicEnum::At(int position) const {
         // Catch if the position is invalid
-        if ((position < 0) || ((int) name_to_position_.size() <= position)) {
+        if ((position < 0) || (Size() <= position)) {
             // Return an indication that the position is invalid
             return std::nullopt;
         }
 
         // Get the enum value's name at the requested position
-        return position_to_name_[position];
+        return members_[Select(static_cast<std::uint32_t>(position))].name_;
     }
 
-    std::optional<int> DynamicEnum::At(const std::string& name) {
+    std::optional<int> DynamicEnum::At(const std::string& name) const {
         // Catch if the name is invalid
-        if (!Has(name)) {
+        auto search_result = name_to_id_.find(name);
+        if (search_result == name_to_id_.end()) {
             // Return an indication that the position is invalid
             return std::nullopt;
         }
 
         // Get the enum value's position at the requested name
-        return name_to_position_[name];
+        return Position(search_result->second);
+    }
+
+    std::optional<int> DynamicEnum::At(const std::string& name, EnumBinding& binding) const {
+        // Resolve the name again only if the enum values have changed since it was cached
+        if (binding.revision_ != revision_) {
+            // Follow the cached EnumId to its new position, looking the name up only if the enum value is gone
+            if (!Live(binding.id_) || (members_[binding.id_].name_ != name)) {
+                binding.id_ = Id(name).value_or(kInvalidEnumId);
+            }
+            binding.position_ = Position(binding.id_);
+            binding.revision_ = revision_;
+        }
+
+        // Provide the cached position
+        return binding.position_;
+    }
+
+    std::optional<EnumId> DynamicEnum::Id(const std::string& name) const {
+        // Catch if the name is invalid
+        auto search_result = name_to_id_.find(name);
+        if (search_result == name_to_id_.end()) {
+            return std::nullopt;
+        }
+
+        // Provide the enum value's EnumId
+        return search_result->second;
+    }
+
+    std::optional<EnumId> DynamicEnum::Id(int position) const {
+        // Catch if the position is invalid
+        if ((position < 0) || (Size() <= position)) {
+            return std::nullopt;
+        }
+
+        // Find the enum value at the position
+        return Select(static_cast<std::uint32_t>(position));
+    }
+
+    std::optional<int> DynamicEnum::Position(EnumId id) const {
+        // Catch a removed or unknown enum value
+        if (!Live(id)) {
+            return std::nullopt;
+        }
+
+        // Count the nodes before this one, climbing to the root
+        auto position = SubtreeSize(members_[id].left_);
+        for (auto child = id, parent = members_[id].parent_;
+             parent != kInvalidEnumId;
+             child = parent, parent = members_[parent].parent_) {
+            // Add the parent and its left subtree when climbing up from its right child
+            if (members_[parent].right_ == child) {
+                position += SubtreeSize(members_[parent].left_) + 1;
+            }
+        }
+        return (int) position;
+    }
+
+    std::optional<std::string> DynamicEnum::Name(EnumId id) const {
+        // Catch a removed or unknown enum value
+        if (!Live(id)) {
+            return std::nullopt;
+        }
+
+        // Provide the enum value's name
+        return members_[id].name_;
+    }
+
+    std::uint64_t DynamicEnum::Revision() const {
+        // Provide the revision
+        return revision_;
     }
 
     std::list<std::string> DynamicEnum::List() const {
         // Create a temporary list to store the enum value names in order within
         std::list<std::string> ordered_names;
 
-        // Iterate through the vector to get the enum value names in order
-        for (const auto& current_name: position_to_name_) {
-            // Append the gathered name to the back of the list
-            ordered_names.push_back(current_name);
+        // Walk the tree in position order, keeping the path to the current node
+        std::vector<EnumId> path;
+        auto current_node = root_;
+        while ((current_node != kInvalidEnumId) || !path.empty()) {
+            // Descend to the first node of the current subtree
+            while (current_node != kInvalidEnumId) {
+                path.push_back(current_node);
+                current_node = members_[current_node].left_;
+            }
+
+            // Append the gathered name to the back of the list, then continue after it
+            current_node = path.back();
+            path.pop_back();
+            ordered_names.push_back(members_[current_node].name_);
+            current_node = members_[current_node].right_;
         }
 
         // Return a copy of the temporary list
@@ -107,48 +223,163 @@ namespace expert_system::utility {
 
     bool DynamicEnum::Remove(const std::string& name) {
         // Catch if the requested enum value does not exist
-        if (!Has(name)) {
+        auto position = At(name);
+        if (!position.has_value()) {
             // Stop and indicate failure
             return false;
         }
 
         // Get the position of the enum value and continue from there
-        return Remove(name_to_position_[name]);
+        return Remove(position.value());
     }
 
     bool DynamicEnum::Remove(int position) {
         // Catch if the position is invalid
-        if ((position < 0) || ((int) name_to_position_.size() <= position)) {
+        if ((position < 0) || (Size() <= position)) {
             // Stop and indicate failure
             return false;
         }
 
-        // Remove the enum value from the map and vector
-        name_to_position_.erase(position_to_name_[position]);
-        position_to_name_.erase(position_to_name_.begin() + position);
-
-        // Iterate through the vector, starting at the element first pushed forward
-        for (auto iterator = position_to_name_.begin() + position; iterator != position_to_name_.end(); ++iterator) {
-            // Decrement the position value stored
-            auto current_enum_name = *iterator;
-            name_to_position_[current_enum_name] -= 1;
+        // Cut the enum value out of the tree, which implicitly moves every later enum value 'down'
+        auto [before, rest] = Split(root_, static_cast<std::uint32_t>(position));
+        auto [removed, after] = Split(rest, 1);
+        root_ = Merge(before, after);
+        if (root_ != kInvalidEnumId) {
+            members_[root_].parent_ = kInvalidEnumId;
         }
 
+        // Leave an empty node, and keep its EnumId for the next enum value
+        auto& removed_member = members_[removed];
+        name_to_id_.erase(removed_member.name_);
+        removed_member = Member{std::string(), removed_member.priority_};
+        removed_member.size_ = 0;
+        free_ids_.push_back(removed);
+        Revise();
+
         // Indicate success
         return true;
     }
 
     void DynamicEnum::Clear() {
         // Empty the contents of the map
-        name_to_position_.clear();
+        name_to_id_.clear();
+
+        // Empty the contents of the tree
+        members_.clear();
+        free_ids_.clear();
+        root_ = kInvalidEnumId;
+        Revise();
+    }
+
+    void DynamicEnum::Revise() {
+        // Take the next revision, which no other DynamicEnum has used
+        revision_ = latest_revision.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    std::uint32_t DynamicEnum::SubtreeSize(EnumId node) const {
+        // A missing subtree is empty
+        return (node == kInvalidEnumId) ? 0 : members_[node].size_;
+    }
+
+    void DynamicEnum::Update(EnumId node) {
+        // Recalculate the size, and link the children back to the node
+        auto& member = members_[node];
+        member.size_ = SubtreeSize(member.left_) + SubtreeSize(member.right_) + 1;
+        if (member.left_ != kInvalidEnumId) {
+            members_[member.left_].parent_ = node;
+        }
+        if (member.right_ != kInvalidEnumId) {
+            members_[member.right_].parent_ = node;
+        }
+    }
+
+    EnumId DynamicEnum::Merge(EnumId left, EnumId right) {
+        // Catch a missing subtree
+        if ((left == kInvalidEnumId) || (right == kInvalidEnumId)) {
+            return (left == kInvalidEnumId) ? right : left;
+        }
+
+        // Keep the node with the higher priority as the root
+        if (members_[left].priority_ > members_[right].priority_) {
+            members_[left].right_ = Merge(members_[left].right_, right);
+            Update(left);
+            return left;
+        }
+        members_[right].left_ = Merge(left, members_[right].left_);
+        Update(right);
+        return right;
+    }
+
+    std::pair<EnumId, EnumId> DynamicEnum::Split(EnumId node, std::uint32_t count) {
+        // Catch a missing subtree
+        if (node == kInvalidEnumId) {
+            return {kInvalidEnumId, kInvalidEnumId};
+        }
+
+        // Split the side of the node that contains the boundary
+        auto left_size = SubtreeSize(members_[node].left_);
+        if (count <= left_size) {
+            auto [first, second] = Split(members_[node].left_, count);
+            members_[node].left_ = second;
+            Update(node);
+            if (first != kInvalidEnumId) {
+                members_[first].parent_ = kInvalidEnumId;
+            }
+            return {first, node};
+        }
+        auto [first, second] = Split(members_[node].right_, count - left_size - 1);
+        members_[node].right_ = first;
+        Update(node);
+        if (second != kInvalidEnumId) {
+            members_[second].parent_ = kInvalidEnumId;
+        }
+        return {node, second};
+    }
+
+    EnumId DynamicEnum::Select(std::uint32_t position) const {
+        // Descend towards the position, skipping the subtrees before it
+        auto current_node = root_;
+        while (true) {
+            auto left_size = SubtreeSize(members_[current_node].left_);
+            if (position < left_size) {
+                current_node = members_[current_node].left_;
+            } else if (position == left_size) {
+                return current_node;
+            } else {
+                position -= left_size + 1;
+                current_node = members_[current_node].right_;
+            }
+        }
+    }
+
+    void DynamicEnum::Attach(const std::string& name, std::uint32_t position) {
+        // Create the node, reusing the EnumId of a removed enum value if there is one
+        EnumId new_id;
+        if (free_ids_.empty()) {
+            new_id = static_cast<EnumId>(members_.size());
+            members_.push_back(Member{name, Priority(new_id)});
+        } else {
+            new_id = free_ids_.back();
+            free_ids_.pop_back();
+            members_[new_id] = Member{name, Priority(new_id)};
+        }
+        name_to_id_.emplace(name, new_id);
+
+        // Place the node between the enum values before and after the position
+        auto [before, after] = Split(root_, position);
+        root_ = Merge(Merge(before, new_id), after);
+        members_[root_].parent_ = kInvalidEnumId;
+        Revise();
+    }
 
-        // Empty the contents of the vector
-        position_to_name_.clear();
+    bool DynamicEnum::Live(EnumId id) const {
+        // Removed nodes have no size
+        return (id < members_.size()) && (members_[id].size_ != 0);
     }
 
     void to_json(nlohmann::json& json_sys, const DynamicEnum& target) {
-        // Export the ordered vector of enum value names to the JSON object
-        json_sys = target.position_to_name_;
+        // Export the ordered list of enum value names to the JSON object
+        json_sys = target.List();
     }
 
     void from_json(const nlohmann::json& json_sys, DynamicEnum& target) {
@@ -1,23 +1,69 @@
 #pragma once
 
+#include <cstdint>
+#include <limits>
 #include <list>
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "nlohmann/json.hpp"
 
 namespace expert_system::utility {
 
+        /**
+         * @brief A stable identifier for an enum value, which does not change as other enum values are added or removed.
+         * @warning An EnumId is only meaningful to the DynamicEnum that issued it, and its copies,
+         * and may be reused once its enum value is removed!
+         */
+    using EnumId = std::uint32_t;
+
+        /// The EnumId that never identifies an enum value.
+    constexpr EnumId kInvalidEnumId = std::numeric_limits<EnumId>::max();
+
+        /**
+         * @brief A cached enum value position, remembering which revision of a DynamicEnum it was resolved against.
+         * Allows repeated lookups of the same enum value name to skip hashing it.
+         * The enum value's EnumId is also cached, so that its new position can be found without hashing the name.
+         * @note The default EnumBinding is a valid resolution against an empty DynamicEnum.
+         */
+    struct EnumBinding {
+            /// The revision of the DynamicEnum that the position was resolved against.
+        std::uint64_t revision_ = 0;
+
+            /// The cached EnumId, or kInvalidEnumId if the name was not found.
+        EnumId id_ = kInvalidEnumId;
+
+            /// The cached position, or std::nullopt if the name was not found.
+        std::optional<int> position_;
+    };
+
         /**
          * @brief An enumeration system with customizable values.
          * Capable of being configured at runtime.
+         * The enum values are kept in an order-statistic tree, so that adding, removing or finding the position of
+         * an enum value takes logarithmic time, without renumbering the enum values after it.
+         * Each enum value also has an EnumId, which is kept while other enum values move around it.
          */
     class DynamicEnum {
     public:
             /// Default constructor.
         DynamicEnum() = default;
 
+            /// Copy constructor, the copy shares the original's revision as their enum values are identical.
+        DynamicEnum(const DynamicEnum& other) = default;
+
+            /// Move constructor, leaves the original DynamicEnum empty.
+        DynamicEnum(DynamicEnum&& other) noexcept;
+
+            /// Copy assignment, the copy shares the original's revision as their enum values are identical.
+        DynamicEnum& operator=(const DynamicEnum& other) = default;
+
+            /// Move assignment, leaves the original DynamicEnum empty.
+        DynamicEnum& operator=(DynamicEnum&& other) noexcept;
+
             /**
              * @brief Parameterized constructor, assigns starting enums values.
              * @param [in] ordered_names A list of enum names in ascending order.
@@ -49,13 +95,13 @@ namespace expert_system::utility {
              * @param [in] name The name to search existing enum values for.
              * @return True if the provided name was found, false otherwise.
              */
-        bool Has(const std::string& name);
+        [[nodiscard]] bool Has(const std::string& name) const;
 
             /**
              * @brief Gathers the amount of enum values stored.
              * @return The amount of enum values stored.
              */
-        int Size();
+        [[nodiscard]] int Size() const;
 
             /**
              * @brief Attempts to gather the name of an enum value at a specified position.
@@ -63,7 +109,7 @@ namespace expert_system::utility {
              * @return The name of the enum value, or std::nullopt on failure.
              * @note If the provided position is invalid, this will fail.
              */
-        std::optional<std::string> At(int position);
+        [[nodiscard]] std::optional<std::string> At(int position) const;
 
             /**
              * @brief Attempts to gather the position of an enum value with a specified name.
@@ -71,7 +117,51 @@ namespace expert_system::utility {
              * @return The position of the enum value, or std::nullopt on failure.
              * @note If the provided name is not found, this will fail.
              */
-        std::optional<int> At(const std::string& name);
+        [[nodiscard]] std::optional<int> At(const std::string& name) const;
+
+            /**
+             * @brief Attempts to gather the position of an enum value, reusing a cached position if it is still valid.
+             * @param [in] name The name to search existing enum values for.
+             * @param [in,out] binding The cached position of the name, resolved again if the enum values have changed.
+             * @return The position of the enum value, or std::nullopt on failure.
+             * @note The binding must always be used with the same name.
+             */
+        [[nodiscard]] std::optional<int> At(const std::string& name, EnumBinding& binding) const;
+
+            /**
+             * @brief Attempts to gather the EnumId of an enum value with a specified name.
+             * @param [in] name The name to search existing enum values for.
+             * @return The EnumId of the enum value, or std::nullopt if the name is not found.
+             */
+        [[nodiscard]] std::optional<EnumId> Id(const std::string& name) const;
+
+            /**
+             * @brief Attempts to gather the EnumId of an enum value at a specified position.
+             * @param [in] position The target enum value's position.
+             * @return The EnumId of the enum value, or std::nullopt if the position is invalid.
+             */
+        [[nodiscard]] std::optional<EnumId> Id(int position) const;
+
+            /**
+             * @brief Attempts to gather the current position of an enum value.
+             * @param [in] id The EnumId of the enum value.
+             * @return The position of the enum value, or std::nullopt if the enum value has been removed.
+             */
+        [[nodiscard]] std::optional<int> Position(EnumId id) const;
+
+            /**
+             * @brief Attempts to gather the name of an enum value.
+             * @param [in] id The EnumId of the enum value.
+             * @return The name of the enum value, or std::nullopt if the enum value has been removed.
+             */
+        [[nodiscard]] std::optional<std::string> Name(EnumId id) const;
+
+            /**
+             * @brief Gathers the revision of the enum values, which changes whenever an enum value is added or removed.
+             * @return The revision, which is unique to the current enum values across every DynamicEnum.
+             * @note Every empty DynamicEnum that has never been edited shares revision 0.
+             */
+        [[nodiscard]] std::uint64_t Revision() const;
 
             /**
              * @brief Gathers the entire set of enum value names in ascending order.
@@ -98,23 +188,105 @@ namespace expert_system::utility {
 
             /**
              * @brief Deletes all of the stored enum values.
-             * @note No names or positions will be valid until more enums values are added.
+             * @note No names, positions or EnumIds will be valid until more enums values are added.
              */
         void Clear();
 
     private:
             /**
-             * @brief Stores a mapping of the enum value's names to their positions.
-             * @note The positions of enum values always begin at 0.
+             * @brief A single enum value, as a node of a treap ordered by position.
+             * The links are EnumIds, with kInvalidEnumId for a missing node.
+             */
+        struct Member {
+                /// The name of the enum value, which is emptied once it is removed.
+            std::string name_;
+
+                /// The heap priority of the node, which keeps the tree balanced.
+            std::uint32_t priority_;
+
+                /// The node before this one, in position order.
+            EnumId left_ = kInvalidEnumId;
+
+                /// The node after this one, in position order.
+            EnumId right_ = kInvalidEnumId;
+
+                /// The node that this one is a child of.
+            EnumId parent_ = kInvalidEnumId;
+
+                /// The amount of nodes in this node's subtree, including itself, or 0 once it is removed.
+            std::uint32_t size_ = 1;
+        };
+
+            /// Assigns the enum values a new revision, invalidating every EnumBinding resolved against them.
+        void Revise();
+
+            /**
+             * @brief Gathers the amount of nodes in a subtree.
+             * @param [in] node The root of the subtree, or kInvalidEnumId.
+             * @return The amount of nodes, which is 0 for a missing subtree.
+             */
+        [[nodiscard]] std::uint32_t SubtreeSize(EnumId node) const;
+
+            /**
+             * @brief Recalculates a node's subtree size, and links its children back to it.
+             * @param [in] node The node to update.
+             */
+        void Update(EnumId node);
+
+            /**
+             * @brief Joins two subtrees, with every node of the first placed before the second.
+             * @param [in] left The root of the first subtree, or kInvalidEnumId.
+             * @param [in] right The root of the second subtree, or kInvalidEnumId.
+             * @return The root of the joined subtree.
              */
-        std::unordered_map<std::string, int> name_to_position_;
+        EnumId Merge(EnumId left, EnumId right);
 
             /**
-             * @brief Stores the names of the stored enum values in ascending order.
-             * This mapping is implicitly defined from the name's position in the vector.
-             * @note The positions of enum values always begin at 0.
+             * @brief Splits a subtree by position.
+             * @param [in] node The root of the subtree, or kInvalidEnumId.
+             * @param [in] count The amount of nodes to place in the first subtree.
+             * @return The roots of the first subtree and of the remaining nodes.
              */
-        std::vector<std::string> position_to_name_;
+        std::pair<EnumId, EnumId> Split(EnumId node, std::uint32_t count);
+
+            /**
+             * @brief Finds the node at a position.
+             * @param [in] position The position, which must be valid.
+             * @return The node's EnumId.
+             */
+        [[nodiscard]] EnumId Select(std::uint32_t position) const;
+
+            /**
+             * @brief Adds a new node at a position.
+             * @param [in] name The name of the new enum value, which must not already be used.
+             * @param [in] position The position of the new enum value, which must be valid or equal to Size().
+             */
+        void Attach(const std::string& name, std::uint32_t position);
+
+            /**
+             * @brief Checks if an EnumId refers to an enum value that has not been removed.
+             * @param [in] id The EnumId to check.
+             * @return True if the enum value exists, False otherwise.
+             */
+        [[nodiscard]] bool Live(EnumId id) const;
+
+            /// Maps each enum value's name to its EnumId.
+        std::unordered_map<std::string, EnumId> name_to_id_;
+
+            /**
+             * @brief Stores every enum value that has been added, indexed by EnumId.
+             * Removed enum values leave an empty node, until their EnumId is reused.
+             */
+        std::vector<Member> members_;
+
+            /// The EnumIds of the removed enum values, which are reused before any new EnumId.
+        std::vector<EnumId> free_ids_;
+
+            /// The root of the treap, or kInvalidEnumId if there are no enum values.
+        EnumId root_ = kInvalidEnumId;
+
+            /// The revision of the enum values, see Revision().
+        std::uint64_t revision_ = 0;
 
             /// Enables JSON serializer access to private contents
         friend void to_json(nlohmann::json& json_sys, const DynamicEnum& target);
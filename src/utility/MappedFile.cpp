@@ -0,0 +1,152 @@
+#include "MappedFile.hpp"
+
+#include <utility>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace expert_system::utility {
+
+    MappedFile::~MappedFile() {
+        // Release the mapping
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& target) noexcept {
+        // Take over the target's mapping
+        *this = std::move(target);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& target) noexcept {
+        // Catch self-assignment
+        if (this == &target) {
+            return *this;
+        }
+
+        // Release the current mapping and take over the target's
+        Close();
+        data_ = std::exchange(target.data_, nullptr);
+        size_ = std::exchange(target.size_, 0);
+#if defined(_WIN32)
+        mapping_handle_ = std::exchange(target.mapping_handle_, nullptr);
+#endif
+        return *this;
+    }
+
+    bool MappedFile::Open(const std::string& file_name) {
+        // Release any previous mapping
+        Close();
+
+#if defined(_WIN32)
+        // Attempt to open the file
+        HANDLE file_handle = CreateFileA(file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                         OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file_handle == INVALID_HANDLE_VALUE) {
+            // Catch the error and indicate failure
+            return false;
+        }
+
+        // Catch a file that can't be sized
+        LARGE_INTEGER file_size{};
+        if (!GetFileSizeEx(file_handle, &file_size)) {
+            CloseHandle(file_handle);
+            return false;
+        }
+
+        // Catch an empty file, which can't be mapped but has no data to read
+        if (file_size.QuadPart == 0) {
+            CloseHandle(file_handle);
+            return true;
+        }
+
+        // Map the file, the mapping keeps the file open by itself
+        HANDLE mapping_handle = CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file_handle);
+        if (mapping_handle == nullptr) {
+            return false;
+        }
+        auto mapped_view = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+        if (mapped_view == nullptr) {
+            CloseHandle(mapping_handle);
+            return false;
+        }
+
+        // Store the mapping
+        mapping_handle_ = mapping_handle;
+        data_ = static_cast<const char*>(mapped_view);
+        size_ = (std::size_t) file_size.QuadPart;
+        return true;
+#else
+        // Attempt to open the file
+        int file_descriptor = open(file_name.c_str(), O_RDONLY);
+        if (file_descriptor < 0) {
+            // Catch the error and indicate failure
+            return false;
+        }
+
+        // Catch a file that can't be sized
+        struct stat file_status {};
+        if (fstat(file_descriptor, &file_status) != 0) {
+            close(file_descriptor);
+            return false;
+        }
+
+        // Catch an empty file, which can't be mapped but has no data to read
+        if (file_status.st_size == 0) {
+            close(file_descriptor);
+            return true;
+        }
+
+        // Map the file, the mapping keeps the file open by itself
+        auto mapped_view = mmap(nullptr, (std::size_t) file_status.st_size, PROT_READ, MAP_PRIVATE,
+                                file_descriptor, 0);
+        close(file_descriptor);
+        if (mapped_view == MAP_FAILED) {
+            return false;
+        }
+
+        // Hint that the contents will be read from front to back, and store the mapping
+        madvise(mapped_view, (std::size_t) file_status.st_size, MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(mapped_view);
+        size_ = (std::size_t) file_status.st_size;
+        return true;
+#endif
+    }
+
+    void MappedFile::Close() {
+        // Catch if no data is mapped
+        if (data_ == nullptr) {
+            return;
+        }
+
+        // Unmap the contents
+#if defined(_WIN32)
+        UnmapViewOfFile(data_);
+        CloseHandle(mapping_handle_);
+        mapping_handle_ = nullptr;
+#else
+        munmap(const_cast<char*>(data_), size_);
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    const char* MappedFile::Data() const {
+        // Provide the mapped contents
+        return data_;
+    }
+
+    std::size_t MappedFile::Size() const {
+        // Provide the amount of mapped bytes
+        return size_;
+    }
+
+} // namespace expert_system::utility
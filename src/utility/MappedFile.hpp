@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace expert_system::utility {
+
+        /**
+         * @brief A read-only view of a file's contents, mapped into memory by the operating system.
+         * The file's pages are only read from disk as they are accessed, and are unmapped on destruction.
+         */
+    class MappedFile {
+    public:
+            /// Default constructor, creates a MappedFile without a file.
+        MappedFile() = default;
+
+            /// Destructor, unmaps the file.
+        ~MappedFile();
+
+            /// Use of copy or assignment constructors is not allowed.
+        MappedFile(const MappedFile&) = delete;
+
+            /// Use of copy or assignment constructors is not allowed.
+        MappedFile& operator=(const MappedFile&) = delete;
+
+            /**
+             * @brief Move constructor.
+             * @param [in] target The MappedFile to move, which is left without a file.
+             */
+        MappedFile(MappedFile&& target) noexcept;
+
+            /**
+             * @brief Move assignment operator.
+             * @param [in] target The MappedFile to move, which is left without a file.
+             * @return A reference to this MappedFile.
+             */
+        MappedFile& operator=(MappedFile&& target) noexcept;
+
+            /**
+             * @brief Attempts to map a file into memory, unmapping any previous file.
+             * @param [in] file_name The name of the file.
+             * @return True if the file was mapped, False otherwise.
+             * @note An empty file is mapped successfully, with no data.
+             */
+        bool Open(const std::string& file_name);
+
+            /// Unmaps the file, this will have no effect if no file is mapped.
+        void Close();
+
+            /**
+             * @brief Provides read access to the file's contents.
+             * @return A pointer to the first byte, or nullptr if no data is mapped.
+             */
+        [[nodiscard]] const char* Data() const;
+
+            /**
+             * @brief Gathers the size of the file's contents.
+             * @return The amount of mapped bytes.
+             */
+        [[nodiscard]] std::size_t Size() const;
+
+    private:
+            /// The first byte of the mapped contents.
+        const char* data_ = nullptr;
+
+            /// The amount of mapped bytes.
+        std::size_t size_ = 0;
+
+#if defined(_WIN32)
+            /// The operating system's handle to the file mapping.
+        void* mapping_handle_ = nullptr;
+#endif
+    };
+
+} // namespace expert_system::utility
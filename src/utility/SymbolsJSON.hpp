@@ -38,4 +38,26 @@ namespace expert_system::utility {
 
     constexpr auto JSON_ID_DATABASE_RULES = "database_rules";
 
+    constexpr auto JSON_ID_VALUE = "value";
+
+    constexpr auto JSON_ID_RULE = "rule";
+
+    constexpr auto JSON_ID_ASSIGNMENTS = "assignments";
+
+    constexpr auto JSON_ID_EVENTS = "events";
+
+    constexpr auto JSON_ID_CASES = "cases";
+
+    constexpr auto JSON_ID_CONCLUSIONS = "conclusions";
+
+    constexpr auto JSON_ID_FIRED_RULES = "fired_rules";
+
+    constexpr auto JSON_ID_CYCLES = "cycles";
+
+    constexpr auto JSON_ID_REJECTED_FACTS = "rejected_facts";
+
+    constexpr auto JSON_ID_PRIORITY = "priority";
+
+    constexpr auto JSON_ID_STEP = "step";
+
 }
\ No newline at end of file
@@ -0,0 +1,178 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+namespace expert_system::utility {
+
+    ThreadPool::ThreadPool(std::size_t thread_count) {
+        // Catch a request for the default amount of threads
+        if (thread_count == 0) {
+            thread_count = std::thread::hardware_concurrency();
+        }
+
+        // Make sure at least one thread is started, the hardware may not be detectable
+        if (thread_count == 0) {
+            thread_count = 1;
+        }
+
+        // Start the worker threads
+        workers_.reserve(thread_count);
+        for (std::size_t thread_index = 0; thread_index < thread_count; ++thread_index) {
+            workers_.emplace_back(&ThreadPool::Work, this);
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        // Flag the worker threads to stop
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        task_queued_.notify_all();
+
+        // Wait for the worker threads to finish
+        for (auto& current_worker: workers_) {
+            current_worker.join();
+        }
+    }
+
+    void ThreadPool::Submit(std::function<void()> task) {
+        // Queue the task
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push(std::move(task));
+            ++pending_tasks_;
+        }
+
+        // Wake a worker thread to run it
+        task_queued_.notify_one();
+    }
+
+    void ThreadPool::Wait() {
+        // Block until there are no incomplete tasks
+        std::unique_lock<std::mutex> lock(mutex_);
+        tasks_completed_.wait(lock, [this] { return pending_tasks_ == 0; });
+    }
+
+    void ThreadPool::ParallelFor(std::size_t count, std::size_t batch_size,
+                                 const std::function<void(std::size_t, std::size_t)>& body) {
+        // Catch an empty range
+        if (count == 0) {
+            return;
+        }
+        batch_size = std::max<std::size_t>(batch_size, 1);
+
+        // Split the range evenly, giving each worker thread its own share
+        struct Share {
+                /// Guards the share's bounds from the owner and any thieves.
+            std::mutex mutex_;
+
+                /// The first index that has not been taken.
+            std::size_t begin_ = 0;
+
+                /// One past the last index that has not been taken.
+            std::size_t end_ = 0;
+        };
+        auto share_count = std::min(workers_.size(), count);
+        std::unique_ptr<Share[]> shares(new Share[share_count]);
+        for (std::size_t share_index = 0; share_index < share_count; ++share_index) {
+            shares[share_index].begin_ = count * share_index / share_count;
+            shares[share_index].end_ = count * (share_index + 1) / share_count;
+        }
+
+        // Start one task per share
+        for (std::size_t share_index = 0; share_index < share_count; ++share_index) {
+            Submit([&shares, &body, share_count, share_index, batch_size]() {
+                auto& own_share = shares[share_index];
+                while (true) {
+                    // Take a batch from the front of the task's own share
+                    std::size_t batch_begin = 0;
+                    std::size_t batch_end = 0;
+                    {
+                        std::lock_guard<std::mutex> lock(own_share.mutex_);
+                        batch_begin = own_share.begin_;
+                        batch_end = std::min(own_share.end_, batch_begin + batch_size);
+                        own_share.begin_ = batch_end;
+                    }
+                    if (batch_begin < batch_end) {
+                        body(batch_begin, batch_end);
+                        continue;
+                    }
+
+                    // Find the share with the most remaining indices
+                    std::size_t victim_index = share_count;
+                    std::size_t victim_remaining = 0;
+                    for (std::size_t other_index = 0; other_index < share_count; ++other_index) {
+                        std::lock_guard<std::mutex> lock(shares[other_index].mutex_);
+                        auto remaining = shares[other_index].end_ - shares[other_index].begin_;
+                        if (remaining > victim_remaining) {
+                            victim_index = other_index;
+                            victim_remaining = remaining;
+                        }
+                    }
+
+                    // Stop once there is nothing left to steal
+                    if (victim_index == share_count) {
+                        return;
+                    }
+
+                    // Steal the back half of the victim's share, which may have shrunk since it was found
+                    std::size_t stolen_begin = 0;
+                    std::size_t stolen_end = 0;
+                    {
+                        std::lock_guard<std::mutex> lock(shares[victim_index].mutex_);
+                        auto& victim_share = shares[victim_index];
+                        stolen_end = victim_share.end_;
+                        stolen_begin = victim_share.begin_ + (victim_share.end_ - victim_share.begin_) / 2;
+                        victim_share.end_ = stolen_begin;
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(own_share.mutex_);
+                        own_share.begin_ = stolen_begin;
+                        own_share.end_ = stolen_end;
+                    }
+                }
+            });
+        }
+
+        // Block until every index has been run
+        Wait();
+    }
+
+    std::size_t ThreadPool::Size() const {
+        // Return the amount of worker threads
+        return workers_.size();
+    }
+
+    void ThreadPool::Work() {
+        while (true) {
+            // Wait for a task to be queued, or for the pool to stop
+            std::function<void()> current_task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                task_queued_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+
+                // Catch the pool stopping once all tasks are finished
+                if (tasks_.empty()) {
+                    return;
+                }
+
+                // Take the next task from the queue
+                current_task = std::move(tasks_.front());
+                tasks_.pop();
+            }
+
+            // Run the task outside of the lock
+            current_task();
+
+            // Keep track of the completed task, and wake any waiting threads when none remain
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--pending_tasks_ == 0) {
+                tasks_completed_.notify_all();
+            }
+        }
+    }
+
+} // namespace expert_system::utility
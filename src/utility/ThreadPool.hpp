@@ -0,0 +1,89 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace expert_system::utility {
+
+        /**
+         * @brief A fixed-size pool of worker threads, processing tasks from a shared queue.
+         * The worker threads are started on construction and joined on destruction.
+         */
+    class ThreadPool {
+    public:
+            /**
+             * @brief Parameterized constructor, starts the worker threads.
+             * @param [in] thread_count The amount of worker threads to start.
+             * @note Providing 0 will start one worker thread for each hardware thread.
+             */
+        explicit ThreadPool(std::size_t thread_count = 0);
+
+            /// Destructor, finishes the queued tasks and joins the worker threads.
+        ~ThreadPool();
+
+            /// Use of copy or assignment constructors is not allowed.
+        ThreadPool(const ThreadPool&) = delete;
+
+            /// Use of copy or assignment constructors is not allowed.
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+            /**
+             * @brief Queues a task to be run by one of the worker threads.
+             * @param [in] task The task to run.
+             */
+        void Submit(std::function<void()> task);
+
+            /// Blocks until all of the submitted tasks have been completed.
+        void Wait();
+
+            /**
+             * @brief Runs a function over a range of indices on every worker thread, blocking until all are done.
+             * The range is split evenly between the worker threads, which take small batches from the front of their
+             * own share. A worker thread that runs out steals the back half of the largest remaining share, so that
+             * uneven batches do not leave threads idle.
+             * @param [in] count The amount of indices, from 0 to count - 1.
+             * @param [in] batch_size The maximum amount of indices taken at once, at least 1.
+             * @param [in] body The function to run for each batch, with the first and one past the last index.
+             * @warning This must not be called from one of the pool's own worker threads!
+             */
+        void ParallelFor(std::size_t count, std::size_t batch_size,
+                         const std::function<void(std::size_t, std::size_t)>& body);
+
+            /**
+             * @brief Gathers the amount of worker threads.
+             * @return The size of the pool.
+             */
+        [[nodiscard]] std::size_t Size() const;
+
+    private:
+            /// The loop run by each worker thread, processing tasks until the pool is destroyed.
+        void Work();
+
+            /// The worker threads.
+        std::vector<std::thread> workers_;
+
+            /// The tasks waiting to be run.
+        std::queue<std::function<void()>> tasks_;
+
+            /// Guards the task queue and the task counters.
+        std::mutex mutex_;
+
+            /// Signals the worker threads when a task is queued, or the pool is stopping.
+        std::condition_variable task_queued_;
+
+            /// Signals the waiting threads when all of the tasks have been completed.
+        std::condition_variable tasks_completed_;
+
+            /// The amount of tasks that have been submitted but not yet completed.
+        std::size_t pending_tasks_ = 0;
+
+            /// Flags the worker threads to stop once the task queue is empty.
+        bool stopping_ = false;
+    };
+
+} // namespace expert_system::utility